@@ -12,7 +12,24 @@ Rcpp::List bsvar_cpp(
     const Rcpp::List& prior,              // a list of priors
     const Rcpp::List& starting_values,    // a list of starting values
     const int         thin = 100,         // introduce thinning
-    const bool        show_progress = true
+    const bool        show_progress = true,
+    const Rcpp::List& storage = Rcpp::List::create(), // storage modes of the posterior blocks
+    const int         diagnostics = 0, // 1 - times of the sampling blocks
+    const Rcpp::List& checkpoint = Rcpp::List::create(), // checkpoints of the run
+    const bool        mdd = false // the harmonic-mean estimator of the log marginal data density
+);
+
+Rcpp::List bsvar_chains_cpp(
+    const int&  S,                        // number of draws from the posterior per chain
+    const arma::mat&  Y,                  // NxT dependent variables
+    const arma::mat&  X,                  // KxT dependent variables
+    const arma::field<arma::mat>& VB,     // N-list
+    const Rcpp::List& prior,              // a list of priors
+    const Rcpp::List& starting_values,    // a C-list of lists of starting values, one per chain
+    const int         thin = 100,         // introduce thinning
+    const bool        show_progress = true,
+    const bool        mdd = false,  // the harmonic-mean estimator of the log marginal data density
+    const int         threads = 1   // No. of threads running the chains
 );
 
 #endif  // _BSVAR_H_
\ No newline at end of file
@@ -3,11 +3,111 @@
 #include "progress.hpp"
 #include "msh.h"
 #include "forecast.h"
+#include "parallel.h"
+#include "residuals.h"
 
 using namespace Rcpp;
 using namespace arma;
 
 
+/*______________________function reduce_draws______________________*/
+// computes outcome(s), an (n_rows, n_cols, n_slices) cube, for the draws s in draws, and returns
+// them as an (n_rows, n_cols, n_slices, draws.n_elem) array or, if mean is true, their average 
+// as an (n_rows, n_cols, n_slices, 1) array; the averaged outcomes are computed in blocks of 
+// threads draws and added up in the order of the draws so that only one block is kept in memory
+// and the average does not depend on the number of threads
+template <typename Outcome>
+static Rcpp::NumericVector reduce_draws (
+    const Outcome&      outcome,
+    const arma::uvec&   draws,
+    const int           n_rows,
+    const int           n_cols,
+    const int           n_slices,
+    const bool          mean,
+    const int           threads,
+    Progress&           p
+) {
+  const int       S_draws = draws.n_elem;
+  const R_xlen_t  size_s  = (R_xlen_t)n_rows * n_cols * n_slices;
+  const int       block   = mean ? std::max(threads, 1) : 200;
+  vec             prog_rep_points = arma::round(arma::linspace(0, S_draws, 50));
+  
+  NumericVector   out(mean ? size_s : size_s * S_draws);
+  out.attr("dim")   = IntegerVector::create(n_rows, n_cols, n_slices, mean ? 1 : S_draws);
+  double*         out_memory = out.begin();
+  cube            out_mean(out_memory, n_rows, n_cols, n_slices, false, true);
+  field<cube>     buffer(mean ? block : 0);
+  parallel_error  error;
+  
+  for (int s_start=0; s_start<S_draws; s_start+=block) {
+    
+    const int s_end = std::min(s_start + block, S_draws);
+    
+    // Increment progress bar
+    for (int s=s_start; s<s_end; s++) {
+      if (any(prog_rep_points == s)) p.increment();
+    }
+    // Check for user interrupts
+    checkUserInterrupt();
+    
+    #pragma omp parallel for num_threads(threads) schedule(dynamic)
+    for (int s=s_start; s<s_end; s++) {
+      try {
+        if ( mean ) {
+          buffer(s - s_start) = outcome(draws(s));
+        } else {
+          cube  out_s(out_memory + (R_xlen_t)s * size_s, n_rows, n_cols, n_slices, false, true);
+          out_s             = outcome(draws(s));
+        }
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+    } // END s loop
+    error.rethrow();
+    
+    if ( mean ) {
+      for (int s=s_start; s<s_end; s++) {
+        out_mean         += buffer(s - s_start);
+      } // END s loop
+    }
+  } // END s_start loop
+  
+  if ( mean && S_draws > 0 ) out_mean /= S_draws;
+  
+  return out;
+} // END reduce_draws
+
+
+
+/*______________________function fevd1______________________*/
+// the forecast error variance decomposition for one draw of the irfs and of the variances 
+// of the structural shocks at every horizon in the columns of aux_sigma2, or unit variances 
+// if aux_sigma2 is empty; the contributions of the shocks are the cumulative sums over the 
+// horizons of the squared irfs scaled by the variances, and their shares are obtained by 
+// dividing every row by its sum
+static arma::cube fevd1 (
+    const arma::cube&   aux_irf,          // (N, N, horizon + 1)
+    const arma::mat&    aux_sigma2        // (N, horizon + 1) or empty
+) {
+  const int       N = aux_irf.n_rows;
+  const int       horizon = aux_irf.n_slices;
+  const bool      heterosk = aux_sigma2.n_elem > 0;
+  
+  cube            aux_fevds(N, N, horizon);
+  mat             cumulative(N, N, fill::zeros);
+  
+  for (int h=0; h<horizon; h++) {
+    mat   contribution  = square(aux_irf.slice(h));
+    if ( heterosk ) contribution.each_row() %= trans(aux_sigma2.col(h));
+    cumulative   += contribution;
+    
+    aux_fevds.slice(h)  = cumulative.each_col() / (0.01 * sum(cumulative, 1));
+  }
+  
+  return aux_fevds;
+} // END fevd1
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 arma::cube bsvars_ir1 (
@@ -17,23 +117,22 @@ arma::cube bsvars_ir1 (
     const int     p,
     const bool    standardise = false
 ) {
-  
+  // the impulse responses follow the recursion of the MA coefficients
+  // irf_h = sum_{j=1}^{min(h,p)} A_j irf_{h-j} with irf_0 = inv(B)
   const int       N = aux_B.n_rows;
   cube            aux_irfs(N, N, horizon + 1);  // + 0 horizons
-  mat             A_bold_tmp(N * (p - 1), N * p, fill::eye);
   
     mat   irf_0         = inv(aux_B);
     if ( standardise ) {
       irf_0             = irf_0 * diagmat(pow(diagvec(irf_0), -1));
     }
-    mat   A_bold        = join_cols(aux_A.cols(0, N * p - 1), A_bold_tmp);
-    mat   A_bold_power  = A_bold;
-    
     aux_irfs.slice(0)   = irf_0;
     
     for (int h=1; h<horizon + 1; h++) {
-      aux_irfs.slice(h) = A_bold_power.submat(0, 0, N-1, N-1) * irf_0;
-      A_bold_power      = A_bold_power * A_bold;
+      aux_irfs.slice(h) = aux_A.cols(0, N - 1) * aux_irfs.slice(h - 1);
+      for (int j=2; j<=std::min(h, p); j++) {
+        aux_irfs.slice(h) += aux_A.cols((j - 1) * N, j * N - 1) * aux_irfs.slice(h - j);
+      } // END j loop
     } // END h loop
     
   return aux_irfs;
@@ -47,54 +146,113 @@ arma::field<arma::cube> bsvars_ir (
     arma::cube&   posterior_A,        // (N, K, S)
     const int     horizon,
     const int     p,
-    const bool    standardise = false
+    const bool    standardise = false,
+    const int     threads = 1
 ) {
   
-  const int       N = posterior_B.n_rows;
   const int       S = posterior_B.n_slices;
   
-  cube            aux_irfs(N, N, horizon + 1);
   field<cube>     irfs(S);
+  parallel_error  error;
   
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
   for (int s=0; s<S; s++) {
-    aux_irfs            = bsvars_ir1( posterior_B.slice(s), posterior_A.slice(s), horizon, p , standardise);
-    irfs(s)             = aux_irfs;
+    try {
+      irfs(s)           = bsvars_ir1( posterior_B.slice(s), posterior_A.slice(s), horizon, p , standardise);
+    } catch (std::exception& e) {
+      error.record(e);
+    }
   } // END s loop
+  error.rethrow();
   
   return irfs;
 } // END bsvars_ir
 
 
 
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::NumericVector bsvars_ir_array (
+    arma::cube&   posterior_B,        // (N, N, S)
+    arma::cube&   posterior_A,        // (N, K, S)
+    const int     horizon,
+    const int     p,
+    const bool    standardise = false,
+    const int     threads = 1
+) {
+  // the irfs for all the draws are written into one (N, N, horizon + 1, S) array
+  // that is returned to R without copying
+  const int       N = posterior_B.n_rows;
+  const int       S = posterior_B.n_slices;
+  const R_xlen_t  size_s = (R_xlen_t)N * N * (horizon + 1);
+  
+  NumericVector   irfs(size_s * S);
+  irfs.attr("dim")  = IntegerVector::create(N, N, horizon + 1, S);
+  double*         irfs_memory = irfs.begin();
+  parallel_error  error;
+  
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int s=0; s<S; s++) {
+    try {
+      cube        irfs_s(irfs_memory + (R_xlen_t)s * size_s, N, N, horizon + 1, false, true);
+      irfs_s            = bsvars_ir1( posterior_B.slice(s), posterior_A.slice(s), horizon, p , standardise);
+    } catch (std::exception& e) {
+      error.record(e);
+    }
+  } // END s loop
+  error.rethrow();
+  
+  return irfs;
+} // END bsvars_ir_array
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::NumericVector bsvars_ir_draws (
+    arma::cube&         posterior_B,      // (N, N, S)
+    arma::cube&         posterior_A,      // (N, K, S)
+    const int           horizon,
+    const int           p,
+    const bool          standardise = false,
+    const arma::uvec&   draws = arma::uvec(), // the draws s = 0, ..., S - 1 to use
+    const bool          mean = false,     // return the average of the irfs over the draws
+    const int           threads = 1
+) {
+  // the irfs are computed draw by draw and written into the output right away
+  const int       N = posterior_B.n_rows;
+  Progress        p_(50, false);
+  
+  auto  outcome   = [&](const int s) {
+    return bsvars_ir1( posterior_B.slice(s), posterior_A.slice(s), horizon, p, standardise );
+  };
+  
+  return reduce_draws(outcome, draws, N, N, horizon + 1, mean, threads, p_);
+} // END bsvars_ir_draws
+
+
+
 // [[Rcpp::interfaces(cpp,r)]]
 // [[Rcpp::export]]
 arma::field<arma::cube> bsvars_fevd_homosk (
-    arma::field<arma::cube>&    posterior_irf   // output of bsvars_irf
+    arma::field<arma::cube>&    posterior_irf,  // output of bsvars_irf
+    const int                   threads = 1
 ) {
   
-  const int       N = posterior_irf(0).n_rows;
   const int       S = posterior_irf.n_rows;
-  const int       horizon = posterior_irf(0).n_slices;
   
   field<cube>     fevds(S);
-  cube            aux_fevds(N, N, horizon);
-  cube            tmp_fevds(N, N, horizon);
+  parallel_error  error;
   
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
   for (int s=0; s<S; s++) {
-    for (int h=0; h<horizon; h++) {
-      
-      tmp_fevds.slice(h) = square(posterior_irf(s).slice(h));
-      
-      for (int n=0; n<N; n++) {
-        for (int nn=0; nn<N; nn++) {
-          aux_fevds.subcube(n, nn, h, n, nn, h) = accu(tmp_fevds.subcube(n, nn, 0, n, nn, h));
-        }
-      }
-      aux_fevds.slice(h)  = diagmat(1/sum(aux_fevds.slice(h), 1)) * aux_fevds.slice(h);
+    try {
+      fevds(s)            = fevd1(posterior_irf(s), mat());
+    } catch (std::exception& e) {
+      error.record(e);
     }
-    aux_fevds            *= 100;
-    fevds(s)              = aux_fevds;
   } // END s loop
+  error.rethrow();
   
   return fevds;
 } // END bsvars_fevd_homosk
@@ -108,43 +266,64 @@ arma::field<arma::cube> bsvars_fevd_homosk (
 arma::field<arma::cube> bsvars_fevd_heterosk (
     arma::field<arma::cube>&    posterior_irf,    // output of bsvars_irf
     arma::cube&                 forecast_sigma2,  // (N, H, S) output from forecast_sigma2 or forecast_sigma2_msh
-    arma::mat&                  sigma2_T          // (N, S) the last in the sample
+    arma::mat&                  sigma2_T,         // (N, S) the last in the sample
+    const int                   threads = 1
 ) {
   
-  const int       N = posterior_irf(0).n_rows;
   const int       S = posterior_irf.n_rows;
   const int       horizon = posterior_irf(0).n_slices;
   
   field<cube>     fevds(S);
-  cube            aux_fevds(N, N, horizon);
-  cube            tmp_fevds(N, N, horizon);
+  parallel_error  error;
   
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
   for (int s=0; s<S; s++) {
-    for (int h=0; h<horizon; h++) {
-      if ( h == 0) {
-        mat diag_sigma2     = diagmat(sigma2_T.col(s));
-        tmp_fevds.slice(h)  = square(posterior_irf(s).slice(h)) * diag_sigma2;
-      } else {
-        mat diag_sigma2     = diagmat(forecast_sigma2.slice(s).col(h - 1));
-        tmp_fevds.slice(h)  = square(posterior_irf(s).slice(h)) * diag_sigma2;
-      }
-      
-      for (int n=0; n<N; n++) {
-        for (int nn=0; nn<N; nn++) {
-          aux_fevds.subcube(n, nn, h, n, nn, h) = accu(tmp_fevds.subcube(n, nn, 0, n, nn, h));
-        }
-      }
-      aux_fevds.slice(h)  = diagmat(1/sum(aux_fevds.slice(h), 1)) * aux_fevds.slice(h);
+    try {
+      mat         aux_sigma2  = join_rows(sigma2_T.col(s), forecast_sigma2.slice(s).head_cols(horizon - 1));
+      fevds(s)            = fevd1(posterior_irf(s), aux_sigma2);
+    } catch (std::exception& e) {
+      error.record(e);
     }
-    aux_fevds            *= 100;
-    fevds(s)              = aux_fevds;
   } // END s loop
+  error.rethrow();
   
   return fevds;
 } // END bsvars_fevd_heterosk
 
 
 
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::NumericVector bsvars_fevd_draws (
+    arma::cube&         posterior_B,      // (N, N, S)
+    arma::cube&         posterior_A,      // (N, K, S)
+    arma::cube&         forecast_sigma2,  // (N, horizon, S) or empty for homoskedastic shocks
+    arma::mat&          sigma2_T,         // (N, S) or empty for homoskedastic shocks
+    const int           horizon,
+    const int           p,
+    const arma::uvec&   draws = arma::uvec(), // the draws s = 0, ..., S - 1 to use
+    const bool          mean = false,     // return the average of the fevds over the draws
+    const int           threads = 1
+) {
+  // the irfs of a draw are computed and reduced to its fevds right away, 
+  // so that the irfs of all the draws are never kept in memory
+  const int       N = posterior_B.n_rows;
+  const bool      heterosk = forecast_sigma2.n_elem > 0;
+  Progress        p_(50, false);
+  
+  auto  outcome   = [&](const int s) {
+    cube  aux_irf = bsvars_ir1( posterior_B.slice(s), posterior_A.slice(s), horizon, p, true );
+    if ( heterosk ) {
+      return fevd1(aux_irf, join_rows(sigma2_T.col(s), forecast_sigma2.slice(s).head_cols(horizon)));
+    }
+    return fevd1(aux_irf, mat());
+  };
+  
+  return reduce_draws(outcome, draws, N, N, horizon + 1, mean, threads, p_);
+} // END bsvars_fevd_draws
+
+
+
 
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
@@ -152,7 +331,8 @@ arma::cube bsvars_structural_shocks (
     const arma::cube&     posterior_B,    // (N, N, S)
     const arma::cube&     posterior_A,    // (N, K, S)
     const arma::mat&      Y,              // NxT dependent variables
-    const arma::mat&      X               // KxT dependent variables
+    const arma::mat&      X,              // KxT dependent variables
+    const int             threads = 1
 ) {
   
   const int       N = Y.n_rows;
@@ -160,27 +340,97 @@ arma::cube bsvars_structural_shocks (
   const int       S = posterior_B.n_slices;
   
   cube            structural_shocks(N, T, S);
+  residual_engine engine(posterior_A, X);
+  parallel_error  error;
   
-  for (int s=0; s<S; s++) {
-    structural_shocks.slice(s)    = posterior_B.slice(s) * (Y - posterior_A.slice(s) * X);
-  } // END s loop
+  for (int b=0; b<engine.blocks(); b++) {
+    engine.compute(b);
+    
+    #pragma omp parallel for num_threads(threads) schedule(static)
+    for (int s=engine.first(b); s<engine.last(b); s++) {
+      try {
+        structural_shocks.slice(s)  = engine.shocks(s, posterior_B.slice(s), Y);
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+    } // END s loop
+    error.rethrow();
+  } // END b loop
   
   return structural_shocks;
 } // END bsvars_structural_shocks
 
 
 
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+arma::cube bsvars_hd1 (
+    arma::cube&   aux_irf_T,          // (N, N, T + 1) irfs at T horizons
+    arma::mat&    aux_shocks,         // (N, T) structural shocks
+    const int     t_start = 0,        // first period of the decomposition
+    const int     t_end = -1          // last period of the decomposition, -1 for T - 1
+) {
+  // the decomposition hd(., j, t) = sum_{i<=t} irf(., j, t - i) * shocks(j, i) is for each 
+  // shock j a convolution of its irf sequence with its shock series, computed for all 
+  // periods at once using the fast Fourier transform of length L >= 2T - 1
+  const int       N = aux_shocks.n_rows;
+  const int       T = aux_shocks.n_cols;
+  const int       t_last = (t_end < 0) ? T - 1 : t_end;
+  
+  if ( t_start < 0 || t_last >= T || t_start > t_last ) {
+    stop("Argument t_start and t_end have to determine a window of periods within the sample.");
+  }
+  
+  cube            aux_hds(N, N, t_last - t_start + 1);
+  
+  int             L = 1;
+  while (L < 2 * T - 1) L *= 2;
+  
+  cx_mat          shocks_fft  = fft(trans(aux_shocks), L);      // (L, N)
+  mat             irf_j(T, N);                                  // irfs to shock j, the last horizon is not used
+  
+  for (int j=0; j<N; j++) {
+    for (int h=0; h<T; h++) {
+      irf_j.row(h)    = trans(aux_irf_T.slice(h).col(j));
+    } // END h loop
+    
+    cx_mat  irf_fft   = fft(irf_j, L);                          // (L, N)
+    irf_fft.each_col() %= shocks_fft.col(j);
+    mat   convolution = real(ifft(irf_fft));                    // (L, N)
+    
+    for (int t=t_start; t<=t_last; t++) {
+      aux_hds.slice(t - t_start).col(j) = trans(convolution.row(t));
+    } // END t loop
+  } // END j loop
+  
+  return aux_hds;
+} // END bsvars_hd1
+
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 arma::field<arma::cube> bsvars_hd (
     arma::field<arma::cube>&    posterior_irf_T,    // output of bsvars_irf with irfs at T horizons
     arma::cube&                 structural_shocks,  // NxTxS output bsvars_structural_shocks
-    const bool                  show_progress = true
+    const bool                  show_progress = true,
+    const int                   threads = 1,
+    const int                   t_start = 0,        // first period of the decomposition
+    const int                   t_end = -1          // last period of the decomposition, -1 for T - 1
 ) {
   
-  const int       N = structural_shocks.n_rows;
   const int       T = structural_shocks.n_cols;
   const int       S = structural_shocks.n_slices;
+  const int       t_last = (t_end < 0) ? T - 1 : t_end;
+  
+  // the arguments are validated here, as the checks of bsvars_hd1 must not be reached 
+  // on the worker threads
+  if ( t_start < 0 || t_last >= T || t_start > t_last ) {
+    stop("Argument t_start and t_end have to determine a window of periods within the sample.");
+  }
+  if ( (int)posterior_irf_T.n_elem != S ) {
+    stop("Arguments posterior_irf_T and structural_shocks have different numbers of draws.");
+  }
   
   // Progress bar setup
   vec prog_rep_points = arma::round(arma::linspace(0, S, 50));
@@ -197,60 +447,147 @@ arma::field<arma::cube> bsvars_hd (
   
   
   field<cube>     hds(S);
-  cube            aux_hds(N, N, T);
-  mat             posterior_irf_t(N, N);
+  parallel_error  error;
   
-  for (int s=0; s<S; s++) {
+  // the draws are processed in chunks of 200 by the worker threads,
+  // while the progress bar and user interrupts are handled in between
+  for (int s_start=0; s_start<S; s_start+=200) {
+    
+    const int s_end = std::min(s_start + 200, S);
     
     // Increment progress bar
-    if (any(prog_rep_points == s)) p.increment();
+    for (int s=s_start; s<s_end; s++) {
+      if (any(prog_rep_points == s)) p.increment();
+    }
     // Check for user interrupts
-    if (s % 200 == 0) checkUserInterrupt();
+    checkUserInterrupt();
     
-    for (int t=0; t<T; t++) {
-      
-      cube        hds_at_t(N, N, t + 1);
-      for (int i=0; i<t; i++) {
-        posterior_irf_t   = posterior_irf_T(s).slice(t - i - 1);
-        hds_at_t.slice(i) = posterior_irf_t.each_col() % structural_shocks.slice(s).col(i);
-      } // END i loop
-      
-      aux_hds.slice(t) = sum(hds_at_t, 2);
-    } // END t loop
-    
-    hds(s)          = aux_hds;
-  } // END s loop
+    #pragma omp parallel for num_threads(threads) schedule(dynamic)
+    for (int s=s_start; s<s_end; s++) {
+      try {
+        hds(s)        = bsvars_hd1(posterior_irf_T(s), structural_shocks.slice(s), t_start, t_last);
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+    } // END s loop
+    error.rethrow();
+  } // END s_start loop
   
   return hds;
 } // END bsvars_hd
 
 
 
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::NumericVector bsvars_hd_draws (
+    arma::cube&         posterior_B,      // (N, N, S)
+    arma::cube&         posterior_A,      // (N, K, S)
+    const arma::mat&    Y,                // NxT dependent variables
+    const arma::mat&    X,                // KxT dependent variables
+    const int           p,
+    const arma::uvec&   draws = arma::uvec(), // the draws s = 0, ..., S - 1 to use
+    const bool          mean = false,     // return the average of the hds over the draws
+    const bool          show_progress = true,
+    const int           threads = 1,
+    const int           t_start = 0,      // first period of the decomposition
+    const int           t_end = -1        // last period of the decomposition, -1 for T - 1
+) {
+  // the structural shocks and the irfs at T horizons of a draw are computed and 
+  // reduced to its hds right away, so that they are never kept for all the draws
+  const int       N = Y.n_rows;
+  const int       T = Y.n_cols;
+  const int       t_last = (t_end < 0) ? T - 1 : t_end;
+  
+  // the window is validated here, as the check of bsvars_hd1 must not be reached on the worker threads
+  if ( t_start < 0 || t_last >= T || t_start > t_last ) {
+    stop("Argument t_start and t_end have to determine a window of periods within the sample.");
+  }
+  
+  // Progress bar setup
+  if (show_progress) {
+    Rcout << "**************************************************|" << endl;
+    Rcout << "bsvars: Bayesian Structural Vector Autoregressions|" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " Computing historical decomposition               |" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " This might take a little while :)                " << endl;
+    Rcout << "**************************************************|" << endl;
+  }
+  Progress p_(50, show_progress);
+  
+  auto  outcome   = [&](const int s) {
+    mat   aux_shocks  = posterior_B.slice(s) * (Y - posterior_A.slice(s) * X);
+    cube  aux_irf_T   = bsvars_ir1( posterior_B.slice(s), posterior_A.slice(s), T, p, false );
+    return bsvars_hd1(aux_irf_T, aux_shocks, t_start, t_last);
+  };
+  
+  return reduce_draws(outcome, draws, N, N, t_last - t_start + 1, mean, threads, p_);
+} // END bsvars_hd_draws
+
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 arma::cube bsvars_fitted_values (
   arma::cube&     posterior_A,        // NxKxS
   arma::cube&     posterior_B,        // NxNxS
   arma::cube&     posterior_sigma,    // NxTxS
-  arma::mat&      X                   // KxT
+  arma::mat&      X,                  // KxT
+  const int       threads = 1
 ) {
   
   const int   N = posterior_A.n_rows;
   const int   S = posterior_A.n_slices;
   const int   T = X.n_cols;
   
+  // all the random numbers are drawn on the main thread before the s loop
   cube    fitted_values(N, T, S, fill::randn);
+  residual_engine engine(posterior_A, X);
+  parallel_error  error;
   
-  for (int s=0; s<S; s++) {
-    mat Binv_sigma_norm    = solve(posterior_B.slice(s), posterior_sigma.slice(s) % fitted_values.slice(s));
-    fitted_values.slice(s) = posterior_A.slice(s) * X + Binv_sigma_norm; 
-  } // END s loop
+  for (int b=0; b<engine.blocks(); b++) {
+    engine.compute(b);
+    
+    #pragma omp parallel for num_threads(threads) schedule(static)
+    for (int s=engine.first(b); s<engine.last(b); s++) {
+      try {
+        mat Binv_sigma_norm    = solve(posterior_B.slice(s), posterior_sigma.slice(s) % fitted_values.slice(s));
+        fitted_values.slice(s) = engine.mean(s) + Binv_sigma_norm; 
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+    } // END s loop
+    error.rethrow();
+  } // END b loop
   
   return fitted_values;
 } // END bsvars_fitted_values
 
 
 
+/*______________________function regime_probabilities1______________________*/
+// the filtered, forecasted, or smoothed regime probabilities for one draw
+static arma::mat regime_probabilities1 (
+    const arma::mat&  shocks,           // NxT
+    const arma::mat&  sigma2,           // NxM
+    const arma::mat&  PR_TR,            // MxM
+    const arma::vec&  pi_0,             // Mx1
+    const bool        forecasted,
+    const bool        smoothed
+) {
+  mat   filtered    = filtering_msh(shocks, sigma2, PR_TR, pi_0);
+  
+  if (forecasted) {
+    return PR_TR * filtered;
+  } else if (smoothed) {
+    return smoothing_msh(shocks, PR_TR, filtered);
+  }
+  return filtered;
+} // END regime_probabilities1
+
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 arma::cube bsvars_filter_forecast_smooth (
@@ -267,38 +604,110 @@ arma::cube bsvars_filter_forecast_smooth (
   cube  posterior_PR_TR   = as<cube>(posterior["PR_TR"]);
   mat   posterior_pi_0    = as<mat>(posterior["pi_0"]);
   
-  const int   N           = Y.n_rows;
   const int   M           = posterior_PR_TR.n_rows;
   const int   T           = Y.n_cols;
   const int   S           = posterior_B.n_slices;
   
-  cube  filtered_probabilities(M, T, S);
-  cube  for_smo_probabilities(M, T, S);
-  mat   shocks(N, T);
+  cube  probabilities(M, T, S);
+  residual_engine engine(posterior_A, X);
   
-  for (int s=0; s<S; s++) {
-    shocks                            = posterior_B.slice(s) * ( Y - posterior_A.slice(s) * X );
+  for (int b=0; b<engine.blocks(); b++) {
+    engine.compute(b);
     
-    filtered_probabilities.slice(s)   = filtering_msh(
-      shocks, 
-      posterior_sigma2.slice(s), 
-      posterior_PR_TR.slice(s), 
-      posterior_pi_0.col(s)
-    );
-    
-    if (forecasted) {
-      for_smo_probabilities.slice(s)  = posterior_PR_TR.slice(s) * filtered_probabilities.slice(s);
-    } else if (smoothed) {
-      for_smo_probabilities.slice(s)  = smoothing_msh(shocks, posterior_PR_TR.slice(s), filtered_probabilities.slice(s));
-    }
-  } // END s loop
-  
-  cube  out     = filtered_probabilities;
-  if (forecasted || smoothed) {
-    out         = for_smo_probabilities;
-  }
-  
-  return out;
+    for (int s=engine.first(b); s<engine.last(b); s++) {
+      probabilities.slice(s)  = regime_probabilities1(
+        engine.shocks(s, posterior_B.slice(s), Y), 
+        posterior_sigma2.slice(s), 
+        posterior_PR_TR.slice(s), 
+        posterior_pi_0.col(s),
+        forecasted, 
+        smoothed
+      );
+    } // END s loop
+  } // END b loop
+  
+  return probabilities;
 } // END bsvars_filter_forecast_smooth
 
 
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List bsvars_residual_analyses (
+  Rcpp::List&       posterior,
+  const arma::mat&  Y,
+  const arma::mat&  X,
+  const bool        fitted = true,      // the draws from the data predictive density
+  const int         probabilities = 0,  // the regime probabilities: 0 - none, 1 - filtered, 2 - forecasted, 3 - smoothed
+  const int         threads = 1
+) {
+  // the structural shocks of every draw are computed once and used for the fitted values and
+  // the regime probabilities, so that a report needing all three passes over the draws once;
+  // the fitted values use the element sigma of the posterior, or unit volatilities if absent;
+  // the fitted values and the regime probabilities not requested are empty arrays
+  
+  cube  posterior_B       = as<cube>(posterior["B"]);
+  cube  posterior_A       = as<cube>(posterior["A"]);
+  
+  const int   N           = Y.n_rows;
+  const int   T           = Y.n_cols;
+  const int   S           = posterior_B.n_slices;
+  
+  cube  posterior_sigma, posterior_sigma2, posterior_PR_TR;
+  mat   posterior_pi_0;
+  if ( fitted && posterior.containsElementNamed("sigma") ) {
+    posterior_sigma       = as<cube>(posterior["sigma"]);
+  }
+  if ( probabilities > 0 ) {
+    posterior_sigma2      = as<cube>(posterior["sigma2"]);
+    posterior_PR_TR       = as<cube>(posterior["PR_TR"]);
+    posterior_pi_0        = as<mat>(posterior["pi_0"]);
+  }
+  const int   M           = posterior_PR_TR.n_rows;
+  
+  // all the random numbers are drawn on the main thread before the s loop
+  cube  structural_shocks(N, T, S);
+  cube  fitted_values;
+  if ( fitted ) fitted_values.randn(N, T, S);
+  cube  regime_probabilities(M, T, probabilities > 0 ? S : 0);
+  
+  residual_engine engine(posterior_A, X);
+  parallel_error  error;
+  
+  for (int b=0; b<engine.blocks(); b++) {
+    engine.compute(b);
+    
+    #pragma omp parallel for num_threads(threads) schedule(static)
+    for (int s=engine.first(b); s<engine.last(b); s++) {
+      try {
+        structural_shocks.slice(s)  = engine.shocks(s, posterior_B.slice(s), Y);
+        
+        if ( fitted ) {
+          mat sigma_norm          = fitted_values.slice(s);
+          if ( posterior_sigma.n_elem > 0 ) sigma_norm %= posterior_sigma.slice(s);
+          fitted_values.slice(s)  = engine.mean(s) + solve(posterior_B.slice(s), sigma_norm);
+        }
+        
+        if ( probabilities > 0 ) {
+          regime_probabilities.slice(s) = regime_probabilities1(
+            structural_shocks.slice(s), 
+            posterior_sigma2.slice(s), 
+            posterior_PR_TR.slice(s), 
+            posterior_pi_0.col(s),
+            probabilities == 2, 
+            probabilities == 3
+          );
+        }
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+    } // END s loop
+    error.rethrow();
+  } // END b loop
+  
+  return List::create(
+    _["shocks"]         = structural_shocks,
+    _["fitted"]         = fitted_values,
+    _["probabilities"]  = regime_probabilities
+  );
+} // END bsvars_residual_analyses
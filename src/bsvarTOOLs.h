@@ -19,19 +19,57 @@ arma::field<arma::cube> bsvars_ir (
     arma::cube&   posterior_A,        // (N, K, S)
     const int     horizon,
     const int     p,
-    const bool    standardise = false
+    const bool    standardise = false,
+    const int     threads = 1
+);
+
+
+Rcpp::NumericVector bsvars_ir_array (
+    arma::cube&   posterior_B,        // (N, N, S)
+    arma::cube&   posterior_A,        // (N, K, S)
+    const int     horizon,
+    const int     p,
+    const bool    standardise = false,
+    const int     threads = 1
+);
+
+
+Rcpp::NumericVector bsvars_ir_draws (
+    arma::cube&         posterior_B,      // (N, N, S)
+    arma::cube&         posterior_A,      // (N, K, S)
+    const int           horizon,
+    const int           p,
+    const bool          standardise = false,
+    const arma::uvec&   draws = arma::uvec(), // the draws s = 0, ..., S - 1 to use
+    const bool          mean = false,     // return the average of the irfs over the draws
+    const int           threads = 1
 );
 
 
 arma::field<arma::cube> bsvars_fevd_homosk (
-    arma::field<arma::cube>&    posterior_irf   // output of bsvars_irf
+    arma::field<arma::cube>&    posterior_irf,  // output of bsvars_irf
+    const int                   threads = 1
 );
 
 
 arma::field<arma::cube> bsvars_fevd_heterosk (
     arma::field<arma::cube>&    posterior_irf,    // output of bsvars_irf
     arma::cube&                 forecast_sigma2,  // (N, H, S) output from forecast_sigma2 or forecast_sigma2_msh
-    arma::mat&                  sigma2_T          // (N, S) the last in the sample
+    arma::mat&                  sigma2_T,         // (N, S) the last in the sample
+    const int                   threads = 1
+);
+
+
+Rcpp::NumericVector bsvars_fevd_draws (
+    arma::cube&         posterior_B,      // (N, N, S)
+    arma::cube&         posterior_A,      // (N, K, S)
+    arma::cube&         forecast_sigma2,  // (N, horizon, S) or empty for homoskedastic shocks
+    arma::mat&          sigma2_T,         // (N, S) or empty for homoskedastic shocks
+    const int           horizon,
+    const int           p,
+    const arma::uvec&   draws = arma::uvec(), // the draws s = 0, ..., S - 1 to use
+    const bool          mean = false,     // return the average of the fevds over the draws
+    const int           threads = 1
 );
 
 
@@ -39,13 +77,41 @@ arma::cube bsvars_structural_shocks (
     const arma::cube&     posterior_B,    // (N, N, S)
     const arma::cube&     posterior_A,    // (N, K, S)
     const arma::mat&      Y,              // NxT dependent variables
-    const arma::mat&      X               // KxT dependent variables
+    const arma::mat&      X,              // KxT dependent variables
+    const int             threads = 1
+);
+
+
+arma::cube bsvars_hd1 (
+    arma::cube&   aux_irf_T,          // (N, N, T + 1) irfs at T horizons
+    arma::mat&    aux_shocks,         // (N, T) structural shocks
+    const int     t_start = 0,        // first period of the decomposition
+    const int     t_end = -1          // last period of the decomposition, -1 for T - 1
 );
 
 
 arma::field<arma::cube> bsvars_hd (
     arma::field<arma::cube>&    posterior_irf_T,    // output of bsvars_irf with irfs at T horizons
-    arma::cube&                 structural_shocks   // NxTxS output bsvars_structural_shocks
+    arma::cube&                 structural_shocks,  // NxTxS output bsvars_structural_shocks
+    const bool                  show_progress = true,
+    const int                   threads = 1,
+    const int                   t_start = 0,        // first period of the decomposition
+    const int                   t_end = -1          // last period of the decomposition, -1 for T - 1
+);
+
+
+Rcpp::NumericVector bsvars_hd_draws (
+    arma::cube&         posterior_B,      // (N, N, S)
+    arma::cube&         posterior_A,      // (N, K, S)
+    const arma::mat&    Y,                // NxT dependent variables
+    const arma::mat&    X,                // KxT dependent variables
+    const int           p,
+    const arma::uvec&   draws = arma::uvec(), // the draws s = 0, ..., S - 1 to use
+    const bool          mean = false,     // return the average of the hds over the draws
+    const bool          show_progress = true,
+    const int           threads = 1,
+    const int           t_start = 0,      // first period of the decomposition
+    const int           t_end = -1        // last period of the decomposition, -1 for T - 1
 );
 
 
@@ -53,7 +119,8 @@ arma::cube bsvars_fitted_values (
     arma::cube&     posterior_A,        // NxKxS
     arma::cube&     posterior_B,        // NxNxS
     arma::cube&     posterior_sigma,    // NxTxS
-    arma::mat&      X                   // KxT
+    arma::mat&      X,                  // KxT
+    const int       threads = 1
 );
 
 
@@ -66,4 +133,14 @@ arma::cube bsvars_filter_forecast_smooth (
 );
 
 
+Rcpp::List bsvars_residual_analyses (
+    Rcpp::List&       posterior,
+    const arma::mat&  Y,
+    const arma::mat&  X,
+    const bool        fitted = true,      // the draws from the data predictive density
+    const int         probabilities = 0,  // the regime probabilities: 0 - none, 1 - filtered, 2 - forecasted, 3 - smoothed
+    const int         threads = 1
+);
+
+
 #endif  // _BSVARTOOLS_H_
\ No newline at end of file
@@ -6,6 +6,13 @@
 #include "utils.h"
 #include "sample_ABhyper.h"
 #include "msh.h"
+#include "prior.h"
+#include "rng.h"
+#include "parallel.h"
+#include "storage.h"
+#include "timer.h"
+#include "checkpoint.h"
+#include "mdd.h"
 
 using namespace Rcpp;
 using namespace arma;
@@ -24,7 +31,11 @@ Rcpp::List bsvar_msh_cpp (
     const bool              finiteM = true,
     const bool              MSnotMIX = true,
     const std::string       name_model = "",// just 3 characters
-    const bool              show_progress = true
+    const bool              show_progress = true,
+    const Rcpp::List&       storage = Rcpp::List::create(), // storage modes of the posterior blocks
+    const int               diagnostics = 0, // 1 - times of the sampling blocks
+    const Rcpp::List&       checkpoint = Rcpp::List::create(), // checkpoints of the run
+    const bool              mdd = false     // the harmonic-mean estimator of the log marginal data density
 ) {
   
   std::string oo = "";
@@ -51,6 +62,11 @@ Rcpp::List bsvar_msh_cpp (
   const int   N     = Y.n_rows;
   const int   K     = X.n_rows;
 
+  const bsvar_prior prior_  = read_prior(prior);
+  const std::string name_run  = MSnotMIX ? "bsvar_msh" : "bsvar_mix";
+  const bsvar_checkpoint checkpoint_(checkpoint, name_run, S, thin);
+  const bsvar_storage storage_ = read_storage(storage, name_run, thin, checkpoint_.resumed());
+  
   mat   aux_B       = as<mat>(starting_values["B"]);
   mat   aux_A       = as<mat>(starting_values["A"]);
   mat   aux_sigma2  = as<mat>(starting_values["sigma2"]);
@@ -65,20 +81,38 @@ Rcpp::List bsvar_msh_cpp (
   const int   SS     = floor(S / thin);
   
   cube  posterior_B(N, N, SS);
-  cube  posterior_A(N, K, SS);
-  cube  posterior_sigma2(N, M, SS);
-  cube  posterior_PR_TR(M, M, SS);
-  mat   posterior_pi_0(M, SS);
-  cube  posterior_xi(M, T, SS);
-  cube  posterior_hyper(2 * N + 1, 2, SS);
-  cube  posterior_sigma(N, T, SS);
-  
-  int   ss = 0;
+  posterior_block posterior_A(storage_, "A", N, K, SS);
+  posterior_block posterior_sigma2(storage_, "sigma2", N, M, SS);
+  posterior_block posterior_PR_TR(storage_, "PR_TR", M, M, SS);
+  posterior_block posterior_pi_0(storage_, "pi_0", M, 1, SS, true);
+  posterior_block posterior_xi(storage_, "xi", M, T, SS);
+  posterior_block posterior_hyper(storage_, "hyper", 2 * N + 1, 2, SS);
+  posterior_block posterior_sigma(storage_, "sigma", N, T, SS);
+  
+  mdd_harmonic mdd_(SS, mdd);
+  
+  int   ss = checkpoint_.draws();
+  if ( checkpoint_.resumed() ) {
+    const List saved  = checkpoint_.saved("posterior");
+    posterior_B.head_slices(ss) = as<cube>(saved["B"]).head_slices(ss);
+    posterior_A.restore(saved["A"], ss);
+    posterior_sigma2.restore(saved["sigma2"], ss);
+    posterior_PR_TR.restore(saved["PR_TR"], ss);
+    posterior_pi_0.restore(saved["pi_0"], ss);
+    posterior_xi.restore(saved["xi"], ss);
+    posterior_hyper.restore(saved["hyper"], ss);
+    posterior_sigma.restore(saved["sigma"], ss);
+    const List sampler  = checkpoint_.saved("sampler");
+    if ( sampler.containsElementNamed("mdd") ) mdd_.restore(sampler["mdd"]);
+  }
+  
   for (int t=0; t<T; t++) {
     aux_sigma.col(t)    = pow( aux_sigma2.col(aux_xi.col(t).index_max()) , 0.5 );
   }
   
-  for (int s=0; s<S; s++) {
+  block_timer timer({"hyper", "B", "A", "regimes", "transition", "variances", "storage"}, diagnostics);
+  
+  for (int s=checkpoint_.iteration(); s<S; s++) {
     
     // Increment progress bar
     if (any(prog_rep_points == s)) p.increment();
@@ -86,39 +120,61 @@ Rcpp::List bsvar_msh_cpp (
     if (s % 200 == 0) checkUserInterrupt();
     
     // sample aux_hyper
-    aux_hyper         = sample_hyperparameters(aux_hyper, aux_B, aux_A, VB, prior);
+    timer.tic();
+    aux_hyper         = sample_hyperparameters(aux_hyper, aux_B, aux_A, VB, prior_);
+    timer.toc(0);
     
     // sample aux_B
-    aux_B             = sample_B_heterosk1(aux_B, aux_A, aux_hyper, aux_sigma, Y, X, prior, VB);
+    aux_B             = sample_B_msh1(aux_B, aux_A, aux_hyper, aux_sigma2, aux_xi, Y, X, prior_, VB);
+    timer.toc(1);
     
     // sample aux_A
-    aux_A             = sample_A_heterosk1(aux_A, aux_B, aux_hyper, aux_sigma, Y, X, prior);
+    aux_A             = sample_A_msh1(aux_A, aux_B, aux_hyper, aux_sigma2, aux_xi, Y, X, prior_);
+    timer.toc(2);
       
     // sample aux_xi
     mat U = aux_B * (Y - aux_A * X);
-    aux_xi            = sample_Markov_process_msh(aux_xi, U, aux_sigma2, aux_PR_TR, aux_pi_0, finiteM);
+    if ( MSnotMIX ) {
+      aux_xi          = sample_Markov_process_msh(aux_xi, U, aux_sigma2, aux_PR_TR, aux_pi_0, finiteM);
+    } else {
+      aux_xi          = sample_mixture_regimes(aux_xi, U, aux_sigma2, aux_pi_0, finiteM);
+    }
+    timer.toc(3);
     
     // sample aux_PR_TR
-    List aux_PR_tmp   = sample_transition_probabilities(aux_PR_TR, aux_pi_0, aux_xi, prior, MSnotMIX);
-    aux_PR_TR         = as<mat>(aux_PR_tmp["PR_TR"]);
-    aux_pi_0          = as<vec>(aux_PR_tmp["pi_0"]);
+    sample_transition_probabilities(aux_PR_TR, aux_pi_0, aux_xi, prior_, MSnotMIX);
+    timer.toc(4);
     
     // sample aux_sigma2
-    aux_sigma2        = sample_variances_msh(aux_sigma2, aux_B, aux_A, Y, X, aux_xi, prior);
+    aux_sigma2        = sample_variances_msh(aux_sigma2, aux_B, aux_A, Y, X, aux_xi, prior_);
     for (int t=0; t<T; t++) {
       aux_sigma.col(t)    = pow( aux_sigma2.col(aux_xi.col(t).index_max()) , 0.5 );
     }
+    timer.toc(5);
     
     if (s % thin == 0) {
       posterior_B.slice(ss)      = aux_B;
-      posterior_A.slice(ss)      = aux_A;
-      posterior_sigma2.slice(ss) = aux_sigma2;
-      posterior_PR_TR.slice(ss)  = aux_PR_TR;
-      posterior_pi_0.col(ss)     = aux_pi_0;
-      posterior_xi.slice(ss)     = aux_xi;
-      posterior_hyper.slice(ss)  = aux_hyper;
-      posterior_sigma.slice(ss)  = aux_sigma;
+      posterior_A.record(ss, aux_A);
+      posterior_sigma2.record(ss, aux_sigma2);
+      posterior_PR_TR.record(ss, aux_PR_TR);
+      posterior_pi_0.record(ss, aux_pi_0);
+      posterior_xi.record(ss, aux_xi);
+      posterior_hyper.record(ss, aux_hyper);
+      posterior_sigma.record(ss, aux_sigma);
+      if ( mdd_.enabled() ) mdd_.add(ss, log_likelihood_msh(aux_B * (Y - aux_A * X), aux_B, aux_sigma2, aux_PR_TR, aux_pi_0));
       ss++;
+      timer.toc(6);
+    }
+    
+    if ( checkpoint_.due(s) ) {
+      checkpoint_.write(s + 1, ss,
+        List::create(_["B"] = aux_B, _["A"] = aux_A, _["sigma2"] = aux_sigma2, _["PR_TR"] = aux_PR_TR, 
+                     _["pi_0"] = aux_pi_0, _["xi"] = aux_xi, _["hyper"] = aux_hyper, _["sigma"] = aux_sigma),
+        List::create(_["B"] = posterior_B.head_slices(ss), _["A"] = posterior_A.state(ss), _["sigma2"] = posterior_sigma2.state(ss), 
+                     _["PR_TR"] = posterior_PR_TR.state(ss), _["pi_0"] = posterior_pi_0.state(ss), _["xi"] = posterior_xi.state(ss), 
+                     _["hyper"] = posterior_hyper.state(ss), _["sigma"] = posterior_sigma.state(ss)),
+        List::create(_["mdd"] = mdd_.state())
+      );
     }
   } // END s loop
   
@@ -133,6 +189,197 @@ Rcpp::List bsvar_msh_cpp (
       _["hyper"]    = aux_hyper,
       _["sigma"]    = aux_sigma
     ),
+    _["posterior"]  = List::create(
+      _["B"]        = posterior_B,
+      _["A"]        = posterior_A.result(),
+      _["sigma2"]   = posterior_sigma2.result(),
+      _["PR_TR"]    = posterior_PR_TR.result(),
+      _["pi_0"]     = posterior_pi_0.result(),
+      _["xi"]       = posterior_xi.result(),
+      _["hyper"]    = posterior_hyper.result(),
+      _["sigma"]    = posterior_sigma.result()
+    ),
+    _["diagnostics"]  = timer.result(),
+    _["mdd"]          = mdd_.result()
+  );
+} // END bsvar_msh
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List bsvar_msh_chains_cpp (
+    const int&              S,              // No. of posterior draws per chain
+    const arma::mat&        Y,              // NxT dependent variables
+    const arma::mat&        X,              // KxT explanatory variables
+    const Rcpp::List&       prior,          // a list of priors - original dimensions
+    const arma::field<arma::mat>& VB,       // restrictions on B0
+    const Rcpp::List&       starting_values,// a C-list of lists of starting values, one per chain
+    const int               thin = 100,     // introduce thinning
+    const bool              finiteM = true,
+    const bool              MSnotMIX = true,
+    const std::string       name_model = "",// just 3 characters
+    const bool              show_progress = true,
+    const bool              mdd = false,    // the harmonic-mean estimator of the log marginal data density
+    const int               threads = 1     // No. of threads running the chains
+) {
+  // C independent chains, each with its own random number stream seeded from R's generator,
+  // run on up to threads threads, so that the draws do not depend on the number of threads;
+  // the draws of chain c are in slices [c*SS, (c+1)*SS)
+  const int C       = starting_values.size();
+  
+  std::string oo = "";
+  if ( thin != 1 ) {
+    oo      = ordinal(thin) + " ";
+  }
+  
+  // Progress bar setup
+  vec prog_rep_points = arma::round(arma::linspace(0, S, 50));
+  if (show_progress) {
+    Rcout << "**************************************************|" << endl;
+    Rcout << "bsvars: Bayesian Structural Vector Autoregressions|" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " Gibbs sampler for the SVAR-" << name_model <<" model             |" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " Progress of the MCMC simulation for " << C << " chains of " << S << " draws" << endl;
+    Rcout << "    Every " << oo << "draw is saved via MCMC thinning" << endl;
+    Rcout << " Press Esc to interrupt the computations" << endl;
+    Rcout << "**************************************************|" << endl;
+  }
+  Progress p(50, show_progress);
+  
+  const int   T     = Y.n_cols;
+  const int   N     = Y.n_rows;
+  const int   K     = X.n_rows;
+  
+  const bsvar_prior prior_  = read_prior(prior);
+  std::vector<rng_stream> streams = rng_streams(C);
+  
+  field<mat>  aux_B(C);
+  field<mat>  aux_A(C);
+  field<mat>  aux_sigma2(C);
+  field<mat>  aux_sigma(C);
+  field<mat>  aux_PR_TR(C);
+  field<vec>  aux_pi_0(C);
+  field<mat>  aux_xi(C);
+  field<mat>  aux_hyper(C);
+  
+  for (int c=0; c<C; c++) {
+    const List starting_values_c  = starting_values[c];
+    aux_B(c)        = as<mat>(starting_values_c["B"]);
+    aux_A(c)        = as<mat>(starting_values_c["A"]);
+    aux_sigma2(c)   = as<mat>(starting_values_c["sigma2"]);
+    aux_PR_TR(c)    = as<mat>(starting_values_c["PR_TR"]);
+    aux_pi_0(c)     = as<vec>(starting_values_c["pi_0"]);
+    aux_xi(c)       = as<mat>(starting_values_c["xi"]);
+    aux_hyper(c)    = as<mat>(starting_values_c["hyper"]);
+    aux_sigma(c)    = mat(N, T);
+    for (int t=0; t<T; t++) {
+      aux_sigma(c).col(t)   = pow( aux_sigma2(c).col(aux_xi(c).col(t).index_max()) , 0.5 );
+    }
+  }
+  
+  const int   M     = aux_PR_TR(0).n_rows;
+  
+  const int   SS     = floor(S / thin);
+  
+  cube  posterior_B(N, N, SS * C);
+  cube  posterior_A(N, K, SS * C);
+  cube  posterior_sigma2(N, M, SS * C);
+  cube  posterior_PR_TR(M, M, SS * C);
+  mat   posterior_pi_0(M, SS * C);
+  cube  posterior_xi(M, T, SS * C);
+  cube  posterior_hyper(2 * N + 1, 2, SS * C);
+  cube  posterior_sigma(N, T, SS * C);
+  
+  std::vector<mdd_harmonic> mdd_(C, mdd_harmonic(SS * C, mdd));
+  
+  parallel_error  error;
+  
+  // the chains advance by 200 iterations on the worker threads,
+  // while the progress bar and user interrupts are handled in between
+  for (int s_start=0; s_start<S; s_start+=200) {
+    
+    const int s_end = std::min(s_start + 200, S);
+    
+    // Increment progress bar
+    for (int s=s_start; s<s_end; s++) {
+      if (any(prog_rep_points == s)) p.increment();
+    }
+    // Check for user interrupts
+    checkUserInterrupt();
+    
+    #pragma omp parallel for num_threads(std::max(1, std::min(threads, C))) schedule(static)
+    for (int c=0; c<C; c++) {
+      rng_attach(&streams[c]);
+      try {
+        for (int s=s_start; s<s_end; s++) {
+          
+          // sample aux_hyper
+          aux_hyper(c)    = sample_hyperparameters(aux_hyper(c), aux_B(c), aux_A(c), VB, prior_);
+          
+          // sample aux_B
+          aux_B(c)        = sample_B_msh1(aux_B(c), aux_A(c), aux_hyper(c), aux_sigma2(c), aux_xi(c), Y, X, prior_, VB);
+          
+          // sample aux_A
+          aux_A(c)        = sample_A_msh1(aux_A(c), aux_B(c), aux_hyper(c), aux_sigma2(c), aux_xi(c), Y, X, prior_);
+          
+          // sample aux_xi
+          mat U = aux_B(c) * (Y - aux_A(c) * X);
+          if ( MSnotMIX ) {
+            aux_xi(c)     = sample_Markov_process_msh(aux_xi(c), U, aux_sigma2(c), aux_PR_TR(c), aux_pi_0(c), finiteM);
+          } else {
+            aux_xi(c)     = sample_mixture_regimes(aux_xi(c), U, aux_sigma2(c), aux_pi_0(c), finiteM);
+          }
+          
+          // sample aux_PR_TR
+          sample_transition_probabilities(aux_PR_TR(c), aux_pi_0(c), aux_xi(c), prior_, MSnotMIX);
+          
+          // sample aux_sigma2
+          aux_sigma2(c)   = sample_variances_msh(aux_sigma2(c), aux_B(c), aux_A(c), Y, X, aux_xi(c), prior_);
+          for (int t=0; t<T; t++) {
+            aux_sigma(c).col(t) = pow( aux_sigma2(c).col(aux_xi(c).col(t).index_max()) , 0.5 );
+          }
+          
+          if (s % thin == 0 && s / thin < SS) {
+            const int ss                = c * SS + s / thin;
+            posterior_B.slice(ss)       = aux_B(c);
+            posterior_A.slice(ss)       = aux_A(c);
+            posterior_sigma2.slice(ss)  = aux_sigma2(c);
+            posterior_PR_TR.slice(ss)   = aux_PR_TR(c);
+            posterior_pi_0.col(ss)      = aux_pi_0(c);
+            posterior_xi.slice(ss)      = aux_xi(c);
+            posterior_hyper.slice(ss)   = aux_hyper(c);
+            posterior_sigma.slice(ss)   = aux_sigma(c);
+            if ( mdd ) mdd_[c].add(ss, log_likelihood_msh(aux_B(c) * (Y - aux_A(c) * X), aux_B(c), aux_sigma2(c), aux_PR_TR(c), aux_pi_0(c)));
+          }
+        } // END s loop
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+      rng_attach(nullptr);
+    } // END c loop
+    error.rethrow();
+  } // END s_start loop
+  
+  for (int c=1; c<C; c++) mdd_[0].merge(mdd_[c]);
+  
+  List last_draw(C);
+  for (int c=0; c<C; c++) {
+    last_draw[c]    = List::create(
+      _["B"]        = aux_B(c),
+      _["A"]        = aux_A(c),
+      _["sigma2"]   = aux_sigma2(c),
+      _["PR_TR"]    = aux_PR_TR(c),
+      _["pi_0"]     = aux_pi_0(c),
+      _["xi"]       = aux_xi(c),
+      _["hyper"]    = aux_hyper(c),
+      _["sigma"]    = aux_sigma(c)
+    );
+  }
+  
+  return List::create(
+    _["last_draw"]  = last_draw,
     _["posterior"]  = List::create(
       _["B"]        = posterior_B,
       _["A"]        = posterior_A,
@@ -142,7 +389,7 @@ Rcpp::List bsvar_msh_cpp (
       _["xi"]       = posterior_xi,
       _["hyper"]    = posterior_hyper,
       _["sigma"]    = posterior_sigma
-    )
+    ),
+    _["mdd"]        = mdd_[0].result()
   );
-} // END bsvar_msh
-
+} // END bsvar_msh_chains_cpp
@@ -16,7 +16,28 @@ Rcpp::List bsvar_msh_cpp (
     const bool              finiteM = true,
     const bool              MSnotMIX = true,
     const std::string       name_model = "",
-    const bool              show_progress = true
+    const bool              show_progress = true,
+    const Rcpp::List&       storage = Rcpp::List::create(), // storage modes of the posterior blocks
+    const int               diagnostics = 0, // 1 - times of the sampling blocks
+    const Rcpp::List&       checkpoint = Rcpp::List::create(), // checkpoints of the run
+    const bool              mdd = false // the harmonic-mean estimator of the log marginal data density
+);
+
+
+Rcpp::List bsvar_msh_chains_cpp (
+    const int&              S,              // No. of posterior draws per chain
+    const arma::mat&        Y,              // NxT dependent variables
+    const arma::mat&        X,              // KxT explanatory variables
+    const Rcpp::List&       prior,          // a list of priors - original dimensions
+    const arma::field<arma::mat>& VB,       // restrictions on B0
+    const Rcpp::List&       starting_values,// a C-list of lists of starting values, one per chain
+    const int               thin = 100,     // introduce thinning
+    const bool              finiteM = true,
+    const bool              MSnotMIX = true,
+    const std::string       name_model = "",
+    const bool              show_progress = true,
+    const bool              mdd = false,  // the harmonic-mean estimator of the log marginal data density
+    const int               threads = 1   // No. of threads running the chains
 );
 
 
@@ -6,11 +6,39 @@
 #include "utils.h"
 #include "sample_ABhyper.h"
 #include "sv.h"
+#include "prior.h"
+#include "rng.h"
+#include "parallel.h"
+#include "storage.h"
+#include "timer.h"
+#include "checkpoint.h"
+#include "mdd.h"
 
 using namespace Rcpp;
 using namespace arma;
 
 
+/*______________________function sample_sv1______________________*/
+// updates the SV process of equation n and the corresponding row of aux_sigma
+static void sample_sv1 (
+    sv_state&               aux_sv,
+    arma::mat&              aux_sigma,  // NxT
+    const int               n,
+    const arma::mat&        U,          // NxT
+    const bsvar_prior&      prior,
+    const bool              centred_sv
+) {
+  if ( centred_sv ) {
+    svar_ce1( aux_sv, n, U.row(n), prior, true );
+    aux_sigma.row(n)  = exp(0.5 * trans(aux_sv.h.col(n)));
+  } else {
+    svar_nc1( aux_sv, n, U.row(n), prior, true );
+    aux_sigma.row(n)  = exp(0.5 * aux_sv.omega(n) * trans(aux_sv.h.col(n)));
+  }
+} // END sample_sv1
+
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 Rcpp::List bsvar_sv_cpp (
@@ -22,7 +50,12 @@ Rcpp::List bsvar_sv_cpp (
     const Rcpp::List&             starting_values, 
     const int                     thin = 100, // introduce thinning
     const bool                    centred_sv = false,
-    const bool                    show_progress = true
+    const bool                    show_progress = true,
+    const int                     threads = 0, // No. of threads for the SV block, 0 for R's generator
+    const Rcpp::List&             storage = Rcpp::List::create(), // storage modes of the posterior blocks
+    const int                     diagnostics = 0, // 1 - times of the sampling blocks, 2 - and of the SV equations
+    const Rcpp::List&             checkpoint = Rcpp::List::create(), // checkpoints of the run
+    const bool                    mdd = false // the harmonic-mean estimator of the log marginal data density
 ) {
   // Progress bar setup
   vec prog_rep_points = arma::round(arma::linspace(0, S, 50));
@@ -57,45 +90,85 @@ Rcpp::List bsvar_sv_cpp (
   const int   N     = Y.n_rows;
   const int   K     = X.n_rows;
   
+  const bsvar_prior prior_  = read_prior(prior);
+  const bsvar_checkpoint checkpoint_(checkpoint, "bsvar_sv", S, thin);
+  const bsvar_storage storage_ = read_storage(storage, "bsvar_sv", thin, checkpoint_.resumed());
+  
+  // given U the SV processes are conditionally independent across equations;
+  // for threads > 0 each equation uses its own random number stream seeded from 
+  // R's generator so that the draws are the same for any number of threads, and 
+  // for threads = 0 the equations are sampled in turn from R's generator
+  const bool  parallel_sv = threads > 0 && N > 1;
+  std::vector<rng_stream> streams;
+  if ( parallel_sv ) {
+    // a resumed run continues the streams saved in the checkpoint
+    CharacterVector saved_streams;
+    if ( checkpoint_.resumed() ) {
+      const List sampler  = checkpoint_.saved("sampler");
+      if ( sampler.containsElementNamed("streams") ) saved_streams = sampler["streams"];
+    }
+    if ( saved_streams.size() == N ) {
+      streams.resize(N);
+      for (int n=0; n<N; n++) streams[n].restore(as<std::string>(saved_streams[n]));
+    } else {
+      streams = rng_streams(N);
+    }
+  }
+  parallel_error  error;
+  
   mat   aux_B       = as<mat>(starting_values["B"]);
   mat   aux_A       = as<mat>(starting_values["A"]);
   mat   aux_hyper   = as<mat>(starting_values["hyper"]);  
-  mat   aux_h       = as<mat>(starting_values["h"]);
-  vec   aux_rho     = as<vec>(starting_values["rho"]);
-  vec   aux_omega   = as<vec>(starting_values["omega"]);
-  vec   aux_sigma2v = as<vec>(starting_values["sigma2v"]);
-  umat  aux_S       = as<umat>(starting_values["S"]);
-  vec   aux_sigma2_omega = as<vec>(starting_values["sigma2_omega"]);
-  vec   aux_s_      = as<vec>(starting_values["s_"]);
+  sv_state aux_sv   = read_sv_state(starting_values);
   mat   aux_sigma(N, T);
   
   if ( centred_sv ) {
     for (int n=0; n<N; n++) {
-      aux_sigma.row(n) = exp(0.5 * aux_h.row(n));
+      aux_sigma.row(n) = exp(0.5 * trans(aux_sv.h.col(n)));
     }
   } else {
     for (int n=0; n<N; n++) {
-      aux_sigma.row(n) = exp(0.5 * aux_omega(n) * aux_h.row(n));
+      aux_sigma.row(n) = exp(0.5 * aux_sv.omega(n) * trans(aux_sv.h.col(n)));
     }
   }
   
   const int   SS     = floor(S / thin);
   
   cube  posterior_B(N, N, SS);
-  cube  posterior_A(N, K, SS);
-  cube  posterior_hyper(2 * N + 1, 2, SS);
-  cube  posterior_h(N, T, SS);
-  mat   posterior_rho(N, SS);
-  mat   posterior_omega(N, SS);
-  mat   posterior_sigma2v(N, SS);
-  ucube posterior_S(N, T, SS);
-  mat   posterior_sigma2_omega(N, SS);
-  mat   posterior_s_(N, SS);
-  cube  posterior_sigma(N, T, SS);
-  
-  int   ss = 0;
-  
-  for (int s=0; s<S; s++) {
+  posterior_block posterior_A(storage_, "A", N, K, SS);
+  posterior_block posterior_hyper(storage_, "hyper", 2 * N + 1, 2, SS);
+  posterior_block posterior_h(storage_, "h", N, T, SS);
+  posterior_block posterior_rho(storage_, "rho", N, 1, SS, true);
+  posterior_block posterior_omega(storage_, "omega", N, 1, SS, true);
+  posterior_block posterior_sigma2v(storage_, "sigma2v", N, 1, SS, true);
+  posterior_block posterior_S(storage_, "S", N, T, SS, false, true);
+  posterior_block posterior_sigma2_omega(storage_, "sigma2_omega", N, 1, SS, true);
+  posterior_block posterior_s_(storage_, "s_", N, 1, SS, true);
+  posterior_block posterior_sigma(storage_, "sigma", N, T, SS);
+  
+  mdd_harmonic mdd_(SS, mdd);
+  
+  int   ss = checkpoint_.draws();
+  if ( checkpoint_.resumed() ) {
+    const List saved  = checkpoint_.saved("posterior");
+    posterior_B.head_slices(ss) = as<cube>(saved["B"]).head_slices(ss);
+    posterior_A.restore(saved["A"], ss);
+    posterior_hyper.restore(saved["hyper"], ss);
+    posterior_h.restore(saved["h"], ss);
+    posterior_rho.restore(saved["rho"], ss);
+    posterior_omega.restore(saved["omega"], ss);
+    posterior_sigma2v.restore(saved["sigma2v"], ss);
+    posterior_S.restore(saved["S"], ss);
+    posterior_sigma2_omega.restore(saved["sigma2_omega"], ss);
+    posterior_s_.restore(saved["s_"], ss);
+    posterior_sigma.restore(saved["sigma"], ss);
+    const List sampler  = checkpoint_.saved("sampler");
+    if ( sampler.containsElementNamed("mdd") ) mdd_.restore(sampler["mdd"]);
+  }
+  
+  block_timer timer({"hyper", "B", "A", "sv", "storage"}, diagnostics, N);
+  
+  for (int s=checkpoint_.iteration(); s<S; s++) {
     
     // Increment progress bar
     if (any(prog_rep_points == s)) p.increment();
@@ -103,79 +176,297 @@ Rcpp::List bsvar_sv_cpp (
     if (s % 200 == 0) checkUserInterrupt();
     
     // sample aux_hyper
-    aux_hyper       = sample_hyperparameters( aux_hyper, aux_B, aux_A, VB, prior);
+    timer.tic();
+    aux_hyper       = sample_hyperparameters( aux_hyper, aux_B, aux_A, VB, prior_);
+    timer.toc(0);
     
     // sample aux_B
-    aux_B           = sample_B_heterosk1(aux_B, aux_A, aux_hyper, aux_sigma, Y, X, prior, VB);
+    aux_B           = sample_B_heterosk1(aux_B, aux_A, aux_hyper, aux_sigma, Y, X, prior_, VB);
+    timer.toc(1);
     
     // sample aux_A
-    aux_A           = sample_A_heterosk1(aux_A, aux_B, aux_hyper, aux_sigma, Y, X, prior);
+    aux_A           = sample_A_heterosk1(aux_A, aux_B, aux_hyper, aux_sigma, Y, X, prior_);
+    timer.toc(2);
     
     // sample aux_h, aux_omega and aux_S, aux_sigma2_omega
     mat U = aux_B * (Y - aux_A * X);
     
-    for (int n=0; n<N; n++) {
-      rowvec  h_tmp     = aux_h.row(n);
-      double  rho_tmp   = aux_rho(n);
-      double  omega_tmp = aux_omega(n);
-      double  sigma2v_tmp = aux_sigma2v(n);
-      urowvec S_tmp     = aux_S.row(n);
-      rowvec  U_tmp     = U.row(n);
-      double  s2o_tmp   = aux_sigma2_omega(n);
-      double  s_n       = aux_s_(n);
-      
-      List sv_n;
-      if ( centred_sv ) {
-        sv_n            = svar_ce1( h_tmp, rho_tmp, omega_tmp, sigma2v_tmp, s2o_tmp, s_n, S_tmp, U_tmp, prior, true );
-      } else {
-        sv_n            = svar_nc1( h_tmp, rho_tmp, omega_tmp, sigma2v_tmp, s2o_tmp, s_n, S_tmp, U_tmp, prior, true );
+    if ( parallel_sv ) {
+      #pragma omp parallel for num_threads(threads) schedule(dynamic)
+      for (int n=0; n<N; n++) {
+        rng_attach(&streams[n]);
+        try {
+          const double  start = timer.equations() ? block_timer::now() : 0;
+          sample_sv1( aux_sv, aux_sigma, n, U, prior_, centred_sv );
+          if ( timer.equations() ) timer.add_equation(n, block_timer::now() - start);
+        } catch (std::exception& e) {
+          error.record(e);
+        }
+        rng_attach(nullptr);
       }
-
-      aux_h.row(n)      = as<rowvec>(sv_n["aux_h_n"]);
-      aux_rho(n)        = as<double>(sv_n["aux_rho_n"]);
-      aux_omega(n)      = as<double>(sv_n["aux_omega_n"]);
-      aux_sigma2v(n)    = as<double>(sv_n["aux_sigma2v_n"]);
-      aux_S.row(n)      = as<urowvec>(sv_n["aux_S_n"]);
-      aux_sigma2_omega(n)         = as<double>(sv_n["aux_sigma2_omega_n"]);
-      aux_s_(n)         = as<double>(sv_n["aux_s_n"]);
-
-      if ( centred_sv ) {
-        aux_sigma.row(n)  = exp(0.5 * aux_h.row(n));
-      } else {
-        aux_sigma.row(n)  = exp(0.5 * aux_omega(n) * aux_h.row(n));
+      error.rethrow();
+    } else {
+      for (int n=0; n<N; n++) {
+        const double  start = timer.equations() ? block_timer::now() : 0;
+        sample_sv1( aux_sv, aux_sigma, n, U, prior_, centred_sv );
+        if ( timer.equations() ) timer.add_equation(n, block_timer::now() - start);
       }
     }
+    timer.toc(3);
     
     if (s % thin == 0) {
       posterior_B.slice(ss)          = aux_B;
-      posterior_A.slice(ss)          = aux_A;
-      posterior_hyper.slice(ss)      = aux_hyper;
-      posterior_h.slice(ss)          = aux_h;
-      posterior_rho.col(ss)          = aux_rho;
-      posterior_omega.col(ss)        = aux_omega;
-      posterior_sigma2v.col(ss)       = aux_sigma2v;
-      posterior_S.slice(ss)          = aux_S;
-      posterior_sigma2_omega.col(ss) = aux_sigma2_omega;
-      posterior_s_.col(ss)           = aux_s_;
-      posterior_sigma.slice(ss)      = aux_sigma;
+      posterior_A.record(ss, aux_A);
+      posterior_hyper.record(ss, aux_hyper);
+      if ( posterior_h.kept() ) posterior_h.record(ss, mat(aux_sv.h.t()));
+      posterior_rho.record(ss, aux_sv.rho);
+      posterior_omega.record(ss, aux_sv.omega);
+      posterior_sigma2v.record(ss, aux_sv.sigma2v);
+      if ( posterior_S.kept() ) posterior_S.record(ss, umat(aux_sv.S.t()));
+      posterior_sigma2_omega.record(ss, aux_sv.sigma2_omega);
+      posterior_s_.record(ss, aux_sv.s_);
+      posterior_sigma.record(ss, aux_sigma);
+      if ( mdd_.enabled() ) mdd_.add(ss, log_likelihood_shocks(aux_B * (Y - aux_A * X), aux_B, aux_sigma));
       ss++;
+      timer.toc(4);
+    }
+    
+    if ( checkpoint_.due(s) ) {
+      CharacterVector state_streams(streams.size());
+      for (int n=0; n<(int)streams.size(); n++) state_streams[n] = streams[n].state();
+      checkpoint_.write(s + 1, ss,
+        List::create(_["B"] = aux_B, _["A"] = aux_A, _["hyper"] = aux_hyper, _["h"] = mat(aux_sv.h.t()), 
+                     _["rho"] = aux_sv.rho, _["omega"] = aux_sv.omega, _["sigma2v"] = aux_sv.sigma2v, 
+                     _["S"] = umat(aux_sv.S.t()), _["sigma2_omega"] = aux_sv.sigma2_omega, _["s_"] = aux_sv.s_, 
+                     _["sigma"] = aux_sigma),
+        List::create(_["B"] = posterior_B.head_slices(ss), _["A"] = posterior_A.state(ss), _["hyper"] = posterior_hyper.state(ss), 
+                     _["h"] = posterior_h.state(ss), _["rho"] = posterior_rho.state(ss), _["omega"] = posterior_omega.state(ss), 
+                     _["sigma2v"] = posterior_sigma2v.state(ss), _["S"] = posterior_S.state(ss), 
+                     _["sigma2_omega"] = posterior_sigma2_omega.state(ss), _["s_"] = posterior_s_.state(ss), 
+                     _["sigma"] = posterior_sigma.state(ss)),
+        List::create(_["streams"] = state_streams, _["mdd"] = mdd_.state())
+      );
     }
   } // END s loop
   
+  mat   aux_h       = aux_sv.h.t();
+  umat  aux_S       = aux_sv.S.t();
+  
   return List::create(
     _["last_draw"]  = List::create(
       _["B"]        = aux_B,
       _["A"]        = aux_A,
       _["hyper"]    = aux_hyper,
       _["h"]        = aux_h,
-      _["rho"]      = aux_rho,
-      _["omega"]    = aux_omega,
-      _["sigma2v"]  = aux_sigma2v,
+      _["rho"]      = aux_sv.rho,
+      _["omega"]    = aux_sv.omega,
+      _["sigma2v"]  = aux_sv.sigma2v,
       _["S"]        = aux_S,
-      _["sigma2_omega"] = aux_sigma2_omega,
-      _["s_"]       = aux_s_,
+      _["sigma2_omega"] = aux_sv.sigma2_omega,
+      _["s_"]       = aux_sv.s_,
       _["sigma"]    = aux_sigma
     ),
+    _["posterior"]  = List::create(
+      _["B"]        = posterior_B,
+      _["A"]        = posterior_A.result(),
+      _["hyper"]    = posterior_hyper.result(),
+      _["h"]        = posterior_h.result(),
+      _["rho"]      = posterior_rho.result(),
+      _["omega"]    = posterior_omega.result(),
+      _["sigma2v"]  = posterior_sigma2v.result(),
+      _["S"]        = posterior_S.result(),
+      _["sigma2_omega"] = posterior_sigma2_omega.result(),
+      _["s_"]        = posterior_s_.result(),
+      _["sigma"]    = posterior_sigma.result()
+    ),
+    _["diagnostics"]  = timer.result(),
+    _["mdd"]          = mdd_.result()
+  );
+} // END bsvar_sv_cpp
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List bsvar_sv_chains_cpp (
+    const int&                    S,          // No. of posterior draws per chain
+    const arma::mat&              Y,          // NxT dependent variables
+    const arma::mat&              X,          // KxT explanatory variables
+    const Rcpp::List&             prior,      // a list of priors - original dimensions
+    const arma::field<arma::mat>& VB,         // restrictions on B0
+    const Rcpp::List&             starting_values,  // a C-list of lists of starting values, one per chain
+    const int                     thin = 100, // introduce thinning
+    const bool                    centred_sv = false,
+    const bool                    show_progress = true,
+    const bool                    mdd = false,  // the harmonic-mean estimator of the log marginal data density
+    const int                     threads = 1   // No. of threads running the chains
+) {
+  // C independent chains, each with its own random number stream seeded from R's generator,
+  // run on up to threads threads, so that the draws do not depend on the number of threads;
+  // the draws of chain c are in slices [c*SS, (c+1)*SS)
+  const int C       = starting_values.size();
+  
+  // Progress bar setup
+  vec prog_rep_points = arma::round(arma::linspace(0, S, 50));
+  
+  std::string oo = "";
+  if ( thin != 1 ) {
+    oo      = ordinal(thin) + " ";
+  }
+  
+  std::string       name_model = "";
+  if ( centred_sv ) {
+    name_model        = "    Centred";
+  } else {
+    name_model        = "Non-centred";
+  }
+  
+  if (show_progress) {
+    Rcout << "**************************************************|" << endl;
+    Rcout << "bsvars: Bayesian Structural Vector Autoregressions|" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " Gibbs sampler for the SVAR-SV model              |" << endl;
+    Rcout << "   " << name_model << " SV model is estimated              |" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " Progress of the MCMC simulation for " << C << " chains of " << S << " draws" << endl;
+    Rcout << "    Every " << oo << "draw is saved via MCMC thinning" << endl;
+    Rcout << " Press Esc to interrupt the computations" << endl;
+    Rcout << "**************************************************|" << endl;
+  }
+  Progress p(50, show_progress);
+  
+  const int   T     = Y.n_cols;
+  const int   N     = Y.n_rows;
+  const int   K     = X.n_rows;
+  
+  const bsvar_prior prior_  = read_prior(prior);
+  std::vector<rng_stream> streams = rng_streams(C);
+  
+  field<mat>  aux_B(C);
+  field<mat>  aux_A(C);
+  field<mat>  aux_hyper(C);
+  std::vector<sv_state> aux_sv(C);
+  field<mat>  aux_sigma(C);
+  
+  for (int c=0; c<C; c++) {
+    const List starting_values_c  = starting_values[c];
+    aux_B(c)        = as<mat>(starting_values_c["B"]);
+    aux_A(c)        = as<mat>(starting_values_c["A"]);
+    aux_hyper(c)    = as<mat>(starting_values_c["hyper"]);
+    aux_sv[c]       = read_sv_state(starting_values_c);
+    aux_sigma(c)    = mat(N, T);
+    
+    if ( centred_sv ) {
+      for (int n=0; n<N; n++) {
+        aux_sigma(c).row(n) = exp(0.5 * trans(aux_sv[c].h.col(n)));
+      }
+    } else {
+      for (int n=0; n<N; n++) {
+        aux_sigma(c).row(n) = exp(0.5 * aux_sv[c].omega(n) * trans(aux_sv[c].h.col(n)));
+      }
+    }
+  }
+  
+  const int   SS     = floor(S / thin);
+  
+  cube  posterior_B(N, N, SS * C);
+  cube  posterior_A(N, K, SS * C);
+  cube  posterior_hyper(2 * N + 1, 2, SS * C);
+  cube  posterior_h(N, T, SS * C);
+  mat   posterior_rho(N, SS * C);
+  mat   posterior_omega(N, SS * C);
+  mat   posterior_sigma2v(N, SS * C);
+  ucube posterior_S(N, T, SS * C);
+  mat   posterior_sigma2_omega(N, SS * C);
+  mat   posterior_s_(N, SS * C);
+  cube  posterior_sigma(N, T, SS * C);
+  
+  std::vector<mdd_harmonic> mdd_(C, mdd_harmonic(SS * C, mdd));
+  
+  parallel_error  error;
+  
+  // the chains advance by 200 iterations on the worker threads,
+  // while the progress bar and user interrupts are handled in between
+  for (int s_start=0; s_start<S; s_start+=200) {
+    
+    const int s_end = std::min(s_start + 200, S);
+    
+    // Increment progress bar
+    for (int s=s_start; s<s_end; s++) {
+      if (any(prog_rep_points == s)) p.increment();
+    }
+    // Check for user interrupts
+    checkUserInterrupt();
+    
+    #pragma omp parallel for num_threads(std::max(1, std::min(threads, C))) schedule(static)
+    for (int c=0; c<C; c++) {
+      rng_attach(&streams[c]);
+      try {
+        for (int s=s_start; s<s_end; s++) {
+          
+          // sample aux_hyper
+          aux_hyper(c)    = sample_hyperparameters( aux_hyper(c), aux_B(c), aux_A(c), VB, prior_);
+          
+          // sample aux_B
+          aux_B(c)        = sample_B_heterosk1(aux_B(c), aux_A(c), aux_hyper(c), aux_sigma(c), Y, X, prior_, VB);
+          
+          // sample aux_A
+          aux_A(c)        = sample_A_heterosk1(aux_A(c), aux_B(c), aux_hyper(c), aux_sigma(c), Y, X, prior_);
+          
+          // sample aux_h, aux_omega and aux_S, aux_sigma2_omega
+          mat U = aux_B(c) * (Y - aux_A(c) * X);
+          
+          for (int n=0; n<N; n++) {
+            sample_sv1( aux_sv[c], aux_sigma(c), n, U, prior_, centred_sv );
+          }
+          
+          if (s % thin == 0 && s / thin < SS) {
+            const int ss                      = c * SS + s / thin;
+            posterior_B.slice(ss)             = aux_B(c);
+            posterior_A.slice(ss)             = aux_A(c);
+            posterior_hyper.slice(ss)         = aux_hyper(c);
+            posterior_h.slice(ss)             = aux_sv[c].h.t();
+            posterior_rho.col(ss)             = aux_sv[c].rho;
+            posterior_omega.col(ss)           = aux_sv[c].omega;
+            posterior_sigma2v.col(ss)         = aux_sv[c].sigma2v;
+            posterior_S.slice(ss)             = aux_sv[c].S.t();
+            posterior_sigma2_omega.col(ss)    = aux_sv[c].sigma2_omega;
+            posterior_s_.col(ss)              = aux_sv[c].s_;
+            posterior_sigma.slice(ss)         = aux_sigma(c);
+            if ( mdd ) mdd_[c].add(ss, log_likelihood_shocks(aux_B(c) * (Y - aux_A(c) * X), aux_B(c), aux_sigma(c)));
+          }
+        } // END s loop
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+      rng_attach(nullptr);
+    } // END c loop
+    error.rethrow();
+  } // END s_start loop
+  
+  for (int c=1; c<C; c++) mdd_[0].merge(mdd_[c]);
+  
+  List last_draw(C);
+  for (int c=0; c<C; c++) {
+    mat   aux_h     = aux_sv[c].h.t();
+    umat  aux_S     = aux_sv[c].S.t();
+    last_draw[c]    = List::create(
+      _["B"]        = aux_B(c),
+      _["A"]        = aux_A(c),
+      _["hyper"]    = aux_hyper(c),
+      _["h"]        = aux_h,
+      _["rho"]      = aux_sv[c].rho,
+      _["omega"]    = aux_sv[c].omega,
+      _["sigma2v"]  = aux_sv[c].sigma2v,
+      _["S"]        = aux_S,
+      _["sigma2_omega"] = aux_sv[c].sigma2_omega,
+      _["s_"]       = aux_sv[c].s_,
+      _["sigma"]    = aux_sigma(c)
+    );
+  }
+  
+  return List::create(
+    _["last_draw"]  = last_draw,
     _["posterior"]  = List::create(
       _["B"]        = posterior_B,
       _["A"]        = posterior_A,
@@ -188,8 +479,7 @@ Rcpp::List bsvar_sv_cpp (
       _["sigma2_omega"] = posterior_sigma2_omega,
       _["s_"]        = posterior_s_,
       _["sigma"]    = posterior_sigma
-    )
+    ),
+    _["mdd"]        = mdd_[0].result()
   );
-} // END bsvar_sv_cpp
-
-
+} // END bsvar_sv_chains_cpp
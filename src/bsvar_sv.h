@@ -13,7 +13,26 @@ Rcpp::List bsvar_sv_cpp (
     const Rcpp::List&             starting_values, 
     const int                     thin = 100, // introduce thinning
     const bool                    centred_sv = false,
-    const bool                    show_progress = true
+    const bool                    show_progress = true,
+    const int                     threads = 0, // No. of threads for the SV block, 0 for R's generator
+    const Rcpp::List&             storage = Rcpp::List::create(), // storage modes of the posterior blocks
+    const int                     diagnostics = 0, // 1 - times of the sampling blocks, 2 - and of the SV equations
+    const Rcpp::List&             checkpoint = Rcpp::List::create(), // checkpoints of the run
+    const bool                    mdd = false // the harmonic-mean estimator of the log marginal data density
+);
+
+Rcpp::List bsvar_sv_chains_cpp (
+    const int&                    S,          // No. of posterior draws per chain
+    const arma::mat&              Y,          // NxT dependent variables
+    const arma::mat&              X,          // KxT explanatory variables
+    const Rcpp::List&             prior,      // a list of priors - original dimensions
+    const arma::field<arma::mat>& VB,         // restrictions on B0
+    const Rcpp::List&             starting_values,  // a C-list of lists of starting values, one per chain
+    const int                     thin = 100, // introduce thinning
+    const bool                    centred_sv = false,
+    const bool                    show_progress = true,
+    const bool                    mdd = false,  // the harmonic-mean estimator of the log marginal data density
+    const int                     threads = 1   // No. of threads running the chains
 );
 
 
@@ -6,6 +6,13 @@
 #include "utils.h"
 #include "sample_ABhyper.h"
 #include "sample_t.h"
+#include "prior.h"
+#include "rng.h"
+#include "parallel.h"
+#include "storage.h"
+#include "timer.h"
+#include "checkpoint.h"
+#include "mdd.h"
 
 using namespace Rcpp;
 using namespace arma;
@@ -22,7 +29,11 @@ Rcpp::List bsvar_t_cpp(
   const Rcpp::List& starting_values,    // a list of starting values
   const arma::vec&  adptive_alpha_gamma,// a 2x1 vector of adaptive MH tuning parameters: target acceptance and discounting factor
   const int         thin = 100,         // introduce thinning
-  const bool        show_progress = true
+  const bool        show_progress = true,
+  const Rcpp::List& storage = Rcpp::List::create(), // storage modes of the posterior blocks
+  const int         diagnostics = 0,    // 1 - times of the sampling blocks
+  const Rcpp::List& checkpoint = Rcpp::List::create(), // checkpoints of the run
+  const bool        mdd = false         // the harmonic-mean estimator of the log marginal data density
 ) {
 
   std::string oo = "";
@@ -50,6 +61,10 @@ Rcpp::List bsvar_t_cpp(
   const int N         = Y.n_rows;
   const int K         = X.n_rows;
   
+  const bsvar_prior prior_  = read_prior(prior);
+  const bsvar_checkpoint checkpoint_(checkpoint, "bsvar_t", S, thin);
+  const bsvar_storage storage_ = read_storage(storage, "bsvar_t", thin, checkpoint_.resumed());
+  
   mat     aux_B       = as<mat>(starting_values["B"]);
   mat     aux_A       = as<mat>(starting_values["A"]);
   mat     aux_hyper   = as<mat>(starting_values["hyper"]);
@@ -59,43 +74,80 @@ Rcpp::List bsvar_t_cpp(
   const int   SS    = floor(S / thin);
   
   cube  posterior_B(N, N, SS);
-  cube  posterior_A(N, K, SS);
-  cube  posterior_hyper(2 * N + 1, 2, SS);
-  mat   posterior_lambda(T, SS);
+  posterior_block posterior_A(storage_, "A", N, K, SS);
+  posterior_block posterior_hyper(storage_, "hyper", 2 * N + 1, 2, SS);
+  posterior_block posterior_lambda(storage_, "lambda", T, 1, SS, true);
   vec   posterior_df(SS);
-  mat   tmp_lambda_sqrt(N, T);
   
-  int   ss = 0;
+  // the reduced-form shocks are computed once per iteration, after sampling A, and 
+  // serve the samplers of B and, multiplied by B, of lambda in the next iteration
+  mat   shocks      = Y - aux_A * X;
+  
+  int   ss = checkpoint_.draws();
   
   // the initial value for the adaptive_scale is set to the negative inverse of 
   // Hessian for the posterior log_kenel for df evaluated at df = 30
   double adaptive_scale = pow(0.25 * T * R::psigamma(15, 1) - T * pow(17, -2) - 2 * pow(16, -2), -1);
   
-  for (int s=0; s<S; s++) {
+  // the log-likelihood is conditional on the latent variables lambda
+  mdd_harmonic mdd_(SS, mdd);
+  
+  if ( checkpoint_.resumed() ) {
+    const List saved  = checkpoint_.saved("posterior");
+    posterior_B.head_slices(ss) = as<cube>(saved["B"]).head_slices(ss);
+    posterior_A.restore(saved["A"], ss);
+    posterior_hyper.restore(saved["hyper"], ss);
+    posterior_lambda.restore(saved["lambda"], ss);
+    posterior_df.head(ss)       = as<vec>(saved["df"]).head(ss);
+    const List sampler  = checkpoint_.saved("sampler");
+    adaptive_scale      = as<double>(sampler["adaptive_scale"]);
+    if ( sampler.containsElementNamed("mdd") ) mdd_.restore(sampler["mdd"]);
+  }
+  
+  block_timer timer({"df", "lambda", "hyper", "A", "B", "storage"}, diagnostics);
+  
+  for (int s=checkpoint_.iteration(); s<S; s++) {
   
     // Increment progress bar
     if (any(prog_rep_points == s)) p.increment();
     // Check for user interrupts
     if (s % 200 == 0) checkUserInterrupt();
     
+    timer.tic();
     vec df_tmp      = sample_df ( aux_df, adaptive_scale, aux_lambda, s, adptive_alpha_gamma );
     aux_df          = df_tmp(0); 
     adaptive_scale  = df_tmp(1);
+    timer.toc(0);
     
-    aux_lambda      = sample_lambda ( aux_df, aux_B, aux_A, Y, X );
-    tmp_lambda_sqrt.each_row() = sqrt(aux_lambda.t());
+    aux_lambda      = sample_lambda ( aux_df, aux_B * shocks );
+    timer.toc(1);
     
-    aux_hyper       = sample_hyperparameters(aux_hyper, aux_B, aux_A, VB, prior);
-    aux_A           = sample_A_heterosk1 ( aux_A, aux_B, aux_hyper, tmp_lambda_sqrt, Y, X, prior);
-    aux_B           = sample_B_heterosk1 ( aux_B, aux_A, aux_hyper, tmp_lambda_sqrt, Y, X, prior, VB );
+    aux_hyper       = sample_hyperparameters(aux_hyper, aux_B, aux_A, VB, prior_);
+    timer.toc(2);
+    aux_A           = sample_A_t1 ( aux_A, aux_B, aux_hyper, aux_lambda, Y, X, prior_);
+    shocks          = Y - aux_A * X;
+    timer.toc(3);
+    aux_B           = sample_B_t1 ( aux_B, aux_hyper, aux_lambda, shocks, prior_, VB );
+    timer.toc(4);
     
     if (s % thin == 0) {
       posterior_B.slice(ss)     = aux_B;
-      posterior_A.slice(ss)     = aux_A;
-      posterior_hyper.slice(ss) = aux_hyper;
-      posterior_lambda.col(ss)  = aux_lambda;
+      posterior_A.record(ss, aux_A);
+      posterior_hyper.record(ss, aux_hyper);
+      posterior_lambda.record(ss, aux_lambda);
       posterior_df(ss)          = aux_df;
+      if ( mdd_.enabled() ) mdd_.add(ss, log_likelihood_shocks(aux_B * shocks, aux_B, repmat(sqrt(aux_lambda.t()), N, 1)));
       ss++;
+      timer.toc(5);
+    }
+    
+    if ( checkpoint_.due(s) ) {
+      checkpoint_.write(s + 1, ss,
+        List::create(_["B"] = aux_B, _["A"] = aux_A, _["hyper"] = aux_hyper, _["lambda"] = aux_lambda, _["df"] = aux_df),
+        List::create(_["B"] = posterior_B.head_slices(ss), _["A"] = posterior_A.state(ss), _["hyper"] = posterior_hyper.state(ss), 
+                     _["lambda"] = posterior_lambda.state(ss), _["df"] = posterior_df.head(ss)),
+        List::create(_["adaptive_scale"] = adaptive_scale, _["mdd"] = mdd_.state())
+      );
     }
   } // END s loop
   
@@ -107,12 +159,170 @@ Rcpp::List bsvar_t_cpp(
       _["lambda"]   = aux_lambda,
       _["df"]       = aux_df
     ),
+    _["posterior"]  = List::create(
+      _["B"]        = posterior_B,
+      _["A"]        = posterior_A.result(),
+      _["hyper"]    = posterior_hyper.result(),
+      _["lambda"]   = posterior_lambda.result(),
+      _["df"]       = posterior_df
+    ),
+    _["diagnostics"]  = timer.result(),
+    _["mdd"]          = mdd_.result()
+  );
+} // END bsvar_t_cpp
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List bsvar_t_chains_cpp(
+  const int&  S,                        // number of draws from the posterior per chain
+  const arma::mat&  Y,                  // NxT dependent variables
+  const arma::mat&  X,                  // KxT dependent variables
+  const arma::field<arma::mat>& VB,     // N-list
+  const Rcpp::List& prior,              // a list of priors
+  const Rcpp::List& starting_values,    // a C-list of lists of starting values, one per chain
+  const arma::vec&  adptive_alpha_gamma,// a 2x1 vector of adaptive MH tuning parameters: target acceptance and discounting factor
+  const int         thin = 100,         // introduce thinning
+  const bool        show_progress = true,
+  const bool        mdd = false,        // the harmonic-mean estimator of the log marginal data density
+  const int         threads = 1         // No. of threads running the chains
+) {
+  // C independent chains, each with its own random number stream seeded from R's generator,
+  // run on up to threads threads, so that the draws do not depend on the number of threads;
+  // the draws of chain c are in slices [c*SS, (c+1)*SS)
+  const int C       = starting_values.size();
+  
+  std::string oo = "";
+  if ( thin != 1 ) {
+    oo      = ordinal(thin) + " ";
+  }
+  
+  // Progress bar setup
+  vec prog_rep_points = arma::round(arma::linspace(0, S, 50));
+  if (show_progress) {
+    Rcout << "**************************************************|" << endl;
+    Rcout << "bsvars: Bayesian Structural Vector Autoregressions|" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " Gibbs sampler for the SVAR model                 |" << endl;
+    Rcout << "    with t-distributed structural skocks          |" << endl;
+    Rcout << "**************************************************|" << endl;
+    Rcout << " Progress of the MCMC simulation for " << C << " chains of " << S << " draws" << endl;
+    Rcout << "    Every " << oo << "draw is saved via MCMC thinning" << endl;
+    Rcout << " Press Esc to interrupt the computations" << endl;
+    Rcout << "**************************************************|" << endl;
+  }
+  Progress p(50, show_progress);
+  
+  const int T         = Y.n_cols;
+  const int N         = Y.n_rows;
+  const int K         = X.n_rows;
+  
+  const bsvar_prior prior_  = read_prior(prior);
+  std::vector<rng_stream> streams = rng_streams(C);
+  
+  field<mat>  aux_B(C);
+  field<mat>  aux_A(C);
+  field<mat>  aux_hyper(C);
+  field<vec>  aux_lambda(C);
+  vec         aux_df(C);
+  
+  for (int c=0; c<C; c++) {
+    const List starting_values_c  = starting_values[c];
+    aux_B(c)        = as<mat>(starting_values_c["B"]);
+    aux_A(c)        = as<mat>(starting_values_c["A"]);
+    aux_hyper(c)    = as<mat>(starting_values_c["hyper"]);
+    aux_lambda(c)   = as<vec>(starting_values_c["lambda"]);
+    aux_df(c)       = as<double>(starting_values_c["df"]);
+  }
+  
+  const int   SS    = floor(S / thin);
+  
+  cube  posterior_B(N, N, SS * C);
+  cube  posterior_A(N, K, SS * C);
+  cube  posterior_hyper(2 * N + 1, 2, SS * C);
+  mat   posterior_lambda(T, SS * C);
+  vec   posterior_df(SS * C);
+  std::vector<mdd_harmonic> mdd_(C, mdd_harmonic(SS * C, mdd));
+  
+  // the initial value for the adaptive_scale is set to the negative inverse of 
+  // Hessian for the posterior log_kenel for df evaluated at df = 30
+  vec   adaptive_scale(C);
+  adaptive_scale.fill( pow(0.25 * T * R::psigamma(15, 1) - T * pow(17, -2) - 2 * pow(16, -2), -1) );
+  
+  parallel_error  error;
+  
+  // the chains advance by 200 iterations on the worker threads,
+  // while the progress bar and user interrupts are handled in between
+  for (int s_start=0; s_start<S; s_start+=200) {
+    
+    const int s_end = std::min(s_start + 200, S);
+    
+    // Increment progress bar
+    for (int s=s_start; s<s_end; s++) {
+      if (any(prog_rep_points == s)) p.increment();
+    }
+    // Check for user interrupts
+    checkUserInterrupt();
+    
+    #pragma omp parallel for num_threads(std::max(1, std::min(threads, C))) schedule(static)
+    for (int c=0; c<C; c++) {
+      rng_attach(&streams[c]);
+      try {
+        mat   shocks      = Y - aux_A(c) * X;
+        for (int s=s_start; s<s_end; s++) {
+          
+          vec df_tmp        = sample_df ( aux_df(c), adaptive_scale(c), aux_lambda(c), s, adptive_alpha_gamma );
+          aux_df(c)         = df_tmp(0); 
+          adaptive_scale(c) = df_tmp(1);
+          
+          aux_lambda(c)     = sample_lambda ( aux_df(c), aux_B(c) * shocks );
+          
+          aux_hyper(c)      = sample_hyperparameters(aux_hyper(c), aux_B(c), aux_A(c), VB, prior_);
+          aux_A(c)          = sample_A_t1 ( aux_A(c), aux_B(c), aux_hyper(c), aux_lambda(c), Y, X, prior_);
+          shocks            = Y - aux_A(c) * X;
+          aux_B(c)          = sample_B_t1 ( aux_B(c), aux_hyper(c), aux_lambda(c), shocks, prior_, VB );
+          
+          if (s % thin == 0 && s / thin < SS) {
+            const int ss                = c * SS + s / thin;
+            posterior_B.slice(ss)       = aux_B(c);
+            posterior_A.slice(ss)       = aux_A(c);
+            posterior_hyper.slice(ss)   = aux_hyper(c);
+            posterior_lambda.col(ss)    = aux_lambda(c);
+            posterior_df(ss)            = aux_df(c);
+            if ( mdd ) mdd_[c].add(ss, log_likelihood_shocks(aux_B(c) * shocks, aux_B(c), repmat(sqrt(aux_lambda(c).t()), N, 1)));
+          }
+        } // END s loop
+      } catch (std::exception& e) {
+        error.record(e);
+      }
+      rng_attach(nullptr);
+    } // END c loop
+    error.rethrow();
+  } // END s_start loop
+  
+  for (int c=1; c<C; c++) mdd_[0].merge(mdd_[c]);
+  
+  List last_draw(C);
+  for (int c=0; c<C; c++) {
+    last_draw[c]    = List::create(
+      _["B"]        = aux_B(c),
+      _["A"]        = aux_A(c),
+      _["hyper"]    = aux_hyper(c),
+      _["lambda"]   = aux_lambda(c),
+      _["df"]       = aux_df(c)
+    );
+  }
+  
+  return List::create(
+    _["last_draw"]  = last_draw,
     _["posterior"]  = List::create(
       _["B"]        = posterior_B,
       _["A"]        = posterior_A,
       _["hyper"]    = posterior_hyper,
       _["lambda"]   = posterior_lambda,
       _["df"]       = posterior_df
-    )
+    ),
+    _["mdd"]        = mdd_[0].result()
   );
-} // END bsvar_t_cpp
+} // END bsvar_t_chains_cpp
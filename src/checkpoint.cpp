@@ -0,0 +1,78 @@
+#include <RcppArmadillo.h>
+
+#include "checkpoint.h"
+
+using namespace Rcpp;
+
+
+/*______________________class bsvar_checkpoint______________________*/
+bsvar_checkpoint::bsvar_checkpoint (
+    const Rcpp::List&   checkpoint,
+    const std::string&  model_,
+    const int           S_,
+    const int           thin_
+) : model(model_), every(0), S(S_), thin(thin_), resume(false), first_iteration(0), first_draws(0) {
+  
+  if ( checkpoint.size() == 0 ) return;
+  
+  file              = as<std::string>(checkpoint["file"]);
+  every             = as<int>(checkpoint["every"]);
+  call              = as<List>(checkpoint["call"]);
+  if ( every < 1 ) {
+    stop("Element every of option bsvars.checkpoint must be a positive integer.");
+  }
+  
+  if ( checkpoint.containsElementNamed("state") ) {
+    state           = as<List>(checkpoint["state"]);
+    if ( as<std::string>(state["model"]) != model || as<int>(state["S"]) != S || as<int>(state["thin"]) != thin ) {
+      stop("The checkpoint does not match the model, the number of draws, or the thinning of the run.");
+    }
+    resume          = true;
+    first_iteration = as<int>(state["iteration"]);
+    first_draws     = as<int>(state["draws"]);
+  }
+} // END bsvar_checkpoint
+
+
+
+SEXP bsvar_checkpoint::saved (
+    const std::string&  element
+) const {
+  return state[element];
+} // END saved
+
+
+
+void bsvar_checkpoint::write (
+    const int           iteration,
+    const int           draws,
+    const Rcpp::List&   last_draw,
+    const Rcpp::List&   posterior,
+    const Rcpp::List&   sampler
+) const {
+  
+  // the state of R's random number generator is copied to .Random.seed
+  PutRNGstate();
+  const Environment global  = Environment::global_env();
+  
+  List  out         = List::create(
+    _["model"]      = model,
+    _["S"]          = S,
+    _["thin"]       = thin,
+    _["iteration"]  = iteration,
+    _["draws"]      = draws,
+    _["last_draw"]  = last_draw,
+    _["posterior"]  = posterior,
+    _["sampler"]    = sampler,
+    _["seed"]       = global[".Random.seed"],
+    _["options"]    = List::create(_["file"] = file, _["every"] = every),
+    _["call"]       = call
+  );
+  out.attr("class") = "BSVARCheckpoint";
+  
+  const std::string temporary = file + ".tmp";
+  Function    saveRDS("saveRDS");
+  Function    file_rename("file.rename");
+  saveRDS(out, temporary);
+  file_rename(temporary, file);
+} // END write
@@ -0,0 +1,51 @@
+#ifndef _CHECKPOINT_H_
+#define _CHECKPOINT_H_
+
+#include <RcppArmadillo.h>
+#include <string>
+
+
+// The checkpoints of a run of a sampler. The list of option bsvars.checkpoint completed by
+// the estimate methods has elements file, every with the number of iterations between the
+// checkpoints, call with the arguments of the estimate call, and, if the run resumes from a
+// checkpoint, state with the checkpoint read from file. A checkpoint holds the last draw,
+// the posterior draws recorded so far, the adaptive state of the sampler, and the state of
+// R's random number generator. It is written on the main thread to a temporary file that
+// then replaces file, so that an interruption leaves the previous or the new checkpoint.
+class bsvar_checkpoint {
+  public:
+    bsvar_checkpoint (
+      const Rcpp::List&   checkpoint,
+      const std::string&  model,
+      const int           S,
+      const int           thin
+    );
+    
+    bool  resumed () const    { return resume; }
+    int   iteration () const  { return first_iteration; }   // the first iteration of the run
+    int   draws () const      { return first_draws; }       // the draws recorded before it
+    
+    bool  due (const int s) const {
+      return every > 0 && (s + 1) % every == 0 && s + 1 < S;
+    }
+    
+    SEXP  saved (const std::string& element) const;       // an element of the checkpoint resumed from
+    
+    void  write (
+      const int           iteration,    // the next iteration
+      const int           draws,        // the draws recorded so far
+      const Rcpp::List&   last_draw,
+      const Rcpp::List&   posterior,
+      const Rcpp::List&   sampler       // the adaptive state of the sampler
+    ) const;
+    
+  private:
+    std::string   file, model;
+    int           every, S, thin;
+    bool          resume;
+    int           first_iteration, first_draws;
+    Rcpp::List    call, state;
+};
+
+
+#endif  // _CHECKPOINT_H_
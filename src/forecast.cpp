@@ -1,6 +1,8 @@
 
 #include <RcppArmadillo.h>
-#include "sample.h"
+#include <vector>
+
+#include "rng.h"
 
 using namespace Rcpp;
 using namespace arma;
@@ -58,12 +60,11 @@ arma::cube forecast_sigma2_msh (
     
     int St(M);
     vec PR_ST     = S_T.col(s);
-    NumericVector zeroM   = wrap(seq_len(M) - 1);
     
     for (int h=0; h<horizon; h++) {
       
       PR_ST       = trans(posterior_PR_TR.slice(s)) * PR_ST;
-      St          = csample_num1(zeroM, wrap(PR_ST));
+      St          = rng_categorical(PR_ST);
       forecasts_sigma2.slice(s).col(h) = posterior_sigma2.slice(s).col(St);
       
     } // END h loop
@@ -82,31 +83,39 @@ arma::cube forecast_sigma2_sv (
     arma::mat&    posterior_rho,      // NxS
     arma::mat&    posterior_omega,    // NxS
     const int&    horizon,
-    const bool&   centred_sv = FALSE
+    const bool&   centred_sv = FALSE,
+    const bool    legacy = false
 ) {
+  // legacy = true reproduces the earlier forecasts of the non-centred parameterisation 
+  // that multiplied the log-variances by omega at every horizon
   
   const int       N = posterior_rho.n_rows;
   const int       S = posterior_rho.n_cols;
   
   cube            forecasts_sigma2(N, horizon, S);
-  vec             one(1, fill::value(1));
   
   for (int s=0; s<S; s++) {
     
-    vec     ht    = posterior_h_T.col(s);
-    double  xx    = 0;
+    // the log-variances follow the AR(1) process x_t = rho * x_t-1 + omega * v_t starting from 
+    // x_T = h_T in the centred and x_T = omega * h_T in the non-centred parameterisation
+    const vec   rho_s     = posterior_rho.col(s);
+    const vec   omega_s   = posterior_omega.col(s);
+    mat         xt(rng_randn(N * horizon).memptr(), N, horizon);               // NxH
     
-    for (int h=0; h<horizon; h++) {
-      for (int n=0; n<N; n++) {
-        xx        = randn();
-        if ( centred_sv ) {
-          ht(n)     = posterior_rho(n, s) * ht(n) + posterior_omega(n, s) * xx;
-        } else {
-          ht(n)     = posterior_omega(n, s) * (posterior_rho(n, s) * ht(n) + xx);
-        }
-        forecasts_sigma2(n, h, s) = exp(ht(n));
-      } // END n loop
+    if ( centred_sv ) {
+      xt.col(0)           = rho_s % posterior_h_T.col(s) + omega_s % xt.col(0);
+    } else {
+      xt.col(0)           = omega_s % (rho_s % posterior_h_T.col(s) + xt.col(0));
+    }
+    for (int h=1; h<horizon; h++) {
+      if ( legacy && !centred_sv ) {
+        xt.col(h)         = omega_s % (rho_s % xt.col(h-1) + xt.col(h));
+      } else {
+        xt.col(h)         = rho_s % xt.col(h-1) + omega_s % xt.col(h);
+      }
     } // END h loop
+    
+    forecasts_sigma2.slice(s) = exp(xt);
   } // END s loop
   
   return forecasts_sigma2;
@@ -120,18 +129,26 @@ arma::cube forecast_sigma2_sv (
 // [[Rcpp::export]]
 arma::mat forecast_lambda_t (
     arma::mat&    posterior_df,      // Sx1
-    const int&    horizon
+    const int&    horizon,
+    const bool    legacy = false
 ) {
+  // the latent variables are independent IG2(df + 2, df) draws for every forecast period;
+  // legacy = true reproduces the earlier output in which every element was a product 
+  // of horizon such draws, which is not the predictive distribution of lambda for horizon > 1
   
   const int       S = posterior_df.n_rows;
   mat             forecasts_lambda(horizon, S, fill::ones);
   
   for (int s=0; s<S; s++) {
-    for (int h=0; h<horizon; h++) {
-      double df_s               = as_scalar(posterior_df.row(s));
-      forecasts_lambda.col(s)   *= df_s + 2;
-      forecasts_lambda.col(s)  /= chi2rnd( df_s, horizon );
-    } // END h loop
+    const double  df_s          = posterior_df(s, 0);
+    if ( legacy ) {
+      for (int h=0; h<horizon; h++) {
+        forecasts_lambda.col(s)   *= df_s + 2;
+        forecasts_lambda.col(s)  /= chi2rnd( df_s, horizon );
+      } // END h loop
+    } else {
+      forecasts_lambda.col(s)     = (df_s + 2) / chi2rnd( df_s, horizon );
+    }
   } // END s loop
   
   return forecasts_lambda;
@@ -141,20 +158,18 @@ arma::mat forecast_lambda_t (
 
 
 
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
-arma::cube forecast_bsvars (
-    arma::cube&   posterior_B,        // (N, N, S)
-    arma::cube&   posterior_A,        // (N, K, S)
-    arma::cube&   forecast_sigma2,    // (N, horizon, S)
-    arma::vec&    X_T,                // (K)
-    arma::mat&    exogenous_forecast, // (horizon, d)
-    arma::mat&    cond_forecast,     // (horizon, N)
-    const int&    horizon
+arma::cube forecast_bsvars_inv (
+    const arma::cube&   posterior_B_inv,    // (N, N, S) inverses of the structural matrices
+    const arma::cube&   posterior_A,        // (N, K, S)
+    const arma::cube&   forecast_sigma2,    // (N, horizon, S)
+    const arma::vec&    X_T,                // (K)
+    const arma::mat&    exogenous_forecast, // (horizon, d)
+    const arma::mat&    cond_forecast,      // (horizon, N)
+    const int           horizon
 ) {
   
-  const int   N = posterior_B.n_rows;
-  const int   S = posterior_B.n_slices;
+  const int   N = posterior_B_inv.n_rows;
+  const int   S = posterior_B_inv.n_slices;
   const int   K = posterior_A.n_cols;
   const int   d = exogenous_forecast.n_cols;
   
@@ -166,6 +181,18 @@ arma::cube forecast_bsvars (
     x_t       = X_T.rows(0, K - 1);
   } // END if do_exog
   
+  // the partitions of the conditional forecasts into the given and the forecasted
+  // variables are computed once for every distinct pattern of the missing values
+  std::vector<uvec> patterns;
+  uvec        pattern_h(horizon);
+  for (int h=0; h<horizon; h++) {
+    const uvec  ind_h     = find_finite( cond_forecast.row(h) );
+    int         p         = 0;
+    while ( p < (int)patterns.size() && !(patterns[p].n_elem == ind_h.n_elem && all(patterns[p] == ind_h)) ) p++;
+    if ( p == (int)patterns.size() ) patterns.push_back(ind_h);
+    pattern_h(h)          = p;
+  } // END h loop
+  
   vec         Xt(K);
   cube        forecasts(N, horizon, S);
   
@@ -177,21 +204,30 @@ arma::cube forecast_bsvars (
       Xt          = x_t;
     } // END if do_exog
     
+    // B is fixed over the horizons, so the reduced-form errors are drawn as B^{-1} (sigma % epsilon)
+    const mat&  B_inv             = posterior_B_inv.slice(s);
+    
     for (int h=0; h<horizon; h++) {
       
-      mat   B_inv             = inv(posterior_B.slice(s));
-      mat   s2_diag           = diagmat(forecast_sigma2.slice(s).col(h));
-      mat   Sigma             = B_inv * s2_diag * B_inv.t();
-        
-      vec   cond_forecast_h   = trans(cond_forecast.row(h));
-      uvec  nonf_el           = find_nonfinite( cond_forecast_h );
-      int   nonf_no           = nonf_el.n_elem;
+      const vec   sigma_h         = sqrt(forecast_sigma2.slice(s).col(h));
+      const mat   L               = B_inv.each_row() % sigma_h.t();   // NxN, L * L' is the covariance
+      vec         forecast_h      = posterior_A.slice(s) * Xt + L * rng_randn(N);
       
-      if ( nonf_no == N ) {
-        forecasts.slice(s).col(h) = mvnrnd( posterior_A.slice(s) * Xt, Sigma );
-      } else {
-        forecasts.slice(s).col(h) = mvnrnd_cond( cond_forecast_h, posterior_A.slice(s) * Xt, Sigma );   // does not work if cond_fc_h is all nan
-      } // END if nonf_no
+      const uvec& ind             = patterns[pattern_h(h)];
+      if ( ind.n_elem == (uword)N ) {
+        forecast_h                = trans(cond_forecast.row(h));
+      } else if ( ind.n_elem > 0 ) {
+        // the unconditional draw is shifted by Sigma_.2 * Sigma_22^{-1} * (x_2 - draw_2)
+        // which gives a draw from the conditional distribution given x_2
+        const vec   cond_h        = trans(cond_forecast.row(h));
+        const vec   x2            = cond_h(ind);
+        const mat   Sigma_2       = L * trans(L.rows(ind));           // NxN_2
+        const mat   chol_Sigma_22 = chol(Sigma_2.rows(ind));          // N_2xN_2 upper-triangular
+        const vec   coef          = solve(trimatu(chol_Sigma_22), solve(trimatl(chol_Sigma_22.t()), x2 - forecast_h(ind)));
+        forecast_h               += Sigma_2 * coef;
+        forecast_h(ind)           = x2;
+      } // END if ind
+      forecasts.slice(s).col(h)   = forecast_h;
       
       if ( h != horizon - 1 ) {
         if ( do_exog ) {
@@ -205,5 +241,25 @@ arma::cube forecast_bsvars (
   } // END s loop
   
   return forecasts;
-} // END forecast_bsvar
+} // END forecast_bsvars_inv
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+arma::cube forecast_bsvars (
+    arma::cube&   posterior_B,        // (N, N, S)
+    arma::cube&   posterior_A,        // (N, K, S)
+    arma::cube&   forecast_sigma2,    // (N, horizon, S)
+    arma::vec&    X_T,                // (K)
+    arma::mat&    exogenous_forecast, // (horizon, d)
+    arma::mat&    cond_forecast,     // (horizon, N)
+    const int&    horizon
+) {
+  cube        posterior_B_inv(size(posterior_B));
+  for (uword s=0; s<posterior_B.n_slices; s++) {
+    posterior_B_inv.slice(s)  = inv(posterior_B.slice(s));
+  }
+  return forecast_bsvars_inv(posterior_B_inv, posterior_A, forecast_sigma2, X_T, exogenous_forecast, cond_forecast, horizon);
+} // END forecast_bsvars
 
@@ -25,13 +25,26 @@ arma::cube forecast_sigma2_sv (
     arma::mat&    posterior_rho,      // NxS
     arma::mat&    posterior_omega,    // NxS
     const int&    horizon,
-    const bool&   centred_sv = FALSE
+    const bool&   centred_sv = FALSE,
+    const bool    legacy = false
 );
 
 
 arma::mat forecast_lambda_t (
     arma::mat&    posterior_df,      // Sx1
-    const int&    horizon
+    const int&    horizon,
+    const bool    legacy = false
+);
+
+
+arma::cube forecast_bsvars_inv (
+    const arma::cube&   posterior_B_inv,    // (N, N, S) inverses of the structural matrices
+    const arma::cube&   posterior_A,        // (N, K, S)
+    const arma::cube&   forecast_sigma2,    // (N, horizon, S)
+    const arma::vec&    X_T,                // (K)
+    const arma::mat&    exogenous_forecast, // (horizon, d)
+    const arma::mat&    cond_forecast,      // (horizon, N)
+    const int           horizon
 );
 
 
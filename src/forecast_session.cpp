@@ -0,0 +1,180 @@
+#include <RcppArmadillo.h>
+
+#include "forecast_session.h"
+#include "forecast.h"
+#include "msh.h"
+#include "sv.h"
+
+using namespace Rcpp;
+using namespace arma;
+
+
+
+/*______________________function forecast_session_cpp______________________*/
+// creates a forecast session from the posterior draws, the regressors X_T of the last
+// period, as used by the forecast methods, and the last observation Y_T; the volatility list holds
+// h_T, rho, omega, and centred_sv for model bsvar_sv, sigma2, PR_TR, and xi_T
+// for model bsvar_msh, df for model bsvar_t, and is empty for model bsvar
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+SEXP forecast_session_cpp (
+    const arma::cube&   posterior_B,        // (N, N, S)
+    const arma::cube&   posterior_A,        // (N, K, S)
+    const arma::vec&    X_T,                // (K)
+    const arma::vec&    Y_T,                // (N)
+    const int           p,
+    const std::string&  model,
+    const Rcpp::List&   volatility
+) {
+  const int   N     = posterior_B.n_rows;
+  const int   K     = posterior_A.n_cols;
+  const int   S     = posterior_B.n_slices;
+
+  if ( (int)X_T.n_elem != K ) {
+    stop("Argument X_T must have as many elements as there are columns in posterior A.");
+  }
+  if ( (int)Y_T.n_elem != N ) {
+    stop("Argument Y_T must have N elements.");
+  }
+  if ( K - N * p - 1 < 0 ) {
+    stop("Argument p is not compatible with the dimensions of posterior A.");
+  }
+
+  XPtr<forecast_session> session(new forecast_session, true);
+  session->model    = model;
+  session->N        = N;
+  session->K        = K;
+  session->p        = p;
+  session->d        = K - N * p - 1;
+  session->B        = posterior_B;
+  session->A        = posterior_A;
+  session->X_T      = X_T;
+  session->Y_T      = Y_T;
+
+  // the structural matrices are inverted once for all the forecasts of the session
+  session->B_inv.set_size(N, N, S);
+  for (int s=0; s<S; s++) {
+    session->B_inv.slice(s) = inv(posterior_B.slice(s));
+  }
+
+  if ( model == "bsvar_sv" ) {
+    session->h_T          = as<mat>(volatility["h_T"]);
+    session->rho          = as<mat>(volatility["rho"]);
+    session->omega        = as<mat>(volatility["omega"]);
+    session->centred_sv   = as<bool>(volatility["centred_sv"]);
+  } else if ( model == "bsvar_msh" ) {
+    session->sigma2       = as<cube>(volatility["sigma2"]);
+    session->PR_TR        = as<cube>(volatility["PR_TR"]);
+    session->xi_T         = as<mat>(volatility["xi_T"]);
+  } else if ( model == "bsvar_t" ) {
+    session->df           = as<mat>(volatility["df"]);
+  } else if ( model != "bsvar" ) {
+    stop("Argument model must be one of 'bsvar', 'bsvar_sv', 'bsvar_msh', or 'bsvar_t'.");
+  }
+
+  return session;
+} // END forecast_session_cpp
+
+
+
+/*______________________function forecast_session_update_cpp______________________*/
+// advances the session by one observation: the regressors of the new period are formed
+// from the last observation, its lags, the constant, and the values of the exogenous
+// variables for the new period, the volatility state of every draw is updated using the
+// structural shocks of y, by one step of the Hamilton filter for MSH and one draw of the
+// log-volatility for SV, and y becomes the last observation; returns the number of
+// observations added to the session
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+int forecast_session_update_cpp (
+    SEXP                session,
+    const arma::vec&    y,                  // (N) a new observation
+    const arma::vec&    exogenous           // (d) the exogenous variables for the period of y
+) {
+  XPtr<forecast_session> fs(session);
+  const int   N     = fs->N;
+  const int   K     = fs->K;
+  const int   S     = fs->B.n_slices;
+
+  const int   p     = fs->p;
+  const int   d     = fs->d;
+
+  if ( (int)y.n_elem != N ) {
+    stop("Argument y must have N elements.");
+  }
+  if ( (int)exogenous.n_elem != d ) {
+    stop("Argument exogenous must have as many elements as there are exogenous variables in the model.");
+  }
+
+  // the regressors of the period of y: the last observation, its first p-1 lags, the
+  // constant, and the exogenous variables
+  vec   X_T1      = fs->X_T;
+  X_T1.rows(0, N - 1)           = fs->Y_T;
+  if ( p > 1 ) {
+    X_T1.rows(N, N * p - 1)     = fs->X_T.rows(0, N * (p - 1) - 1);
+  }
+  if ( d > 0 ) {
+    X_T1.rows(K - d, K - 1)     = exogenous;
+  }
+
+  if ( fs->model == "bsvar_sv" || fs->model == "bsvar_msh" ) {
+    for (int s=0; s<S; s++) {
+      const vec   u   = fs->B.slice(s) * (y - fs->A.slice(s) * X_T1);
+
+      if ( fs->model == "bsvar_sv" ) {
+        for (int n=0; n<N; n++) {
+          fs->h_T(n, s) = sample_sv_update1( fs->h_T(n, s), u(n), fs->rho(n, s), fs->omega(n, s), fs->centred_sv );
+        }
+      } else {
+        mat   xi_t;
+        filtering_msh(xi_t, u, fs->sigma2.slice(s), fs->PR_TR.slice(s), fs->xi_T.col(s));
+        fs->xi_T.col(s) = xi_t.col(0);
+      }
+    } // END s loop
+  }
+
+  fs->X_T         = X_T1;
+  fs->Y_T         = y;
+  fs->updates++;
+
+  return fs->updates;
+} // END forecast_session_update_cpp
+
+
+
+/*______________________function forecast_session_forecast_cpp______________________*/
+// forecasts from the current state of the session as the forecast method does
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List forecast_session_forecast_cpp (
+    SEXP                session,
+    const int           horizon,
+    arma::mat&          exogenous_forecast, // (horizon, d)
+    arma::mat&          cond_forecast       // (horizon, N)
+) {
+  XPtr<forecast_session> fs(session);
+  const int   N     = fs->N;
+  const int   S     = fs->B.n_slices;
+
+  cube  forecast_sigma2;
+  if ( fs->model == "bsvar_sv" ) {
+    forecast_sigma2 = forecast_sigma2_sv(fs->h_T, fs->rho, fs->omega, horizon, fs->centred_sv);
+  } else if ( fs->model == "bsvar_msh" ) {
+    forecast_sigma2 = forecast_sigma2_msh(fs->sigma2, fs->PR_TR, fs->xi_T, horizon);
+  } else if ( fs->model == "bsvar_t" ) {
+    const mat lambda  = forecast_lambda_t(fs->df, horizon);   // (horizon, S)
+    forecast_sigma2.set_size(N, horizon, S);
+    for (int s=0; s<S; s++) {
+      forecast_sigma2.slice(s)  = repmat(trans(lambda.col(s)), N, 1);
+    }
+  } else {
+    forecast_sigma2.ones(N, horizon, S);
+  }
+
+  cube  forecasts = forecast_bsvars_inv(fs->B_inv, fs->A, forecast_sigma2, fs->X_T, exogenous_forecast, cond_forecast, horizon);
+
+  return List::create(
+    _["forecasts"]        = forecasts,
+    _["forecasts_sigma"]  = forecast_sigma2
+  );
+} // END forecast_session_forecast_cpp
@@ -0,0 +1,65 @@
+
+#ifndef _FORECAST_SESSION_H_
+#define _FORECAST_SESSION_H_
+
+#include <RcppArmadillo.h>
+#include <string>
+
+
+// The per-draw state needed to forecast from a posterior kept in memory between
+// calls, so that it can be advanced by new observations without re-estimation
+struct forecast_session {
+  std::string   model;            // "bsvar", "bsvar_sv", "bsvar_msh", or "bsvar_t"
+  int           N;
+  int           K;
+  int           p;
+  int           d;
+
+  arma::cube    B;                // (N, N, S)
+  arma::cube    B_inv;            // (N, N, S)
+  arma::cube    A;                // (N, K, S)
+  arma::vec     X_T;              // (K) regressors of the last period
+  arma::vec     Y_T;              // (N) the last observation
+
+  arma::mat     h_T;              // (N, S) SV log-volatilities
+  arma::mat     rho;              // (N, S)
+  arma::mat     omega;            // (N, S)
+  bool          centred_sv  = false;
+
+  arma::cube    sigma2;           // (N, M, S) MSH variances
+  arma::cube    PR_TR;            // (M, M, S)
+  arma::mat     xi_T;             // (M, S) regime probabilities
+
+  arma::mat     df;               // (S, 1) degrees of freedom of t shocks
+
+  int           updates     = 0;
+};
+
+
+SEXP forecast_session_cpp (
+    const arma::cube&   posterior_B,        // (N, N, S)
+    const arma::cube&   posterior_A,        // (N, K, S)
+    const arma::vec&    X_T,                // (K)
+    const arma::vec&    Y_T,                // (N)
+    const int           p,
+    const std::string&  model,
+    const Rcpp::List&   volatility
+);
+
+
+int forecast_session_update_cpp (
+    SEXP                session,
+    const arma::vec&    y,                  // (N) a new observation
+    const arma::vec&    exogenous           // (d) the exogenous variables for the period of y
+);
+
+
+Rcpp::List forecast_session_forecast_cpp (
+    SEXP                session,
+    const int           horizon,
+    arma::mat&          exogenous_forecast, // (horizon, d)
+    arma::mat&          cond_forecast       // (horizon, N)
+);
+
+
+#endif  // _FORECAST_SESSION_H_
@@ -0,0 +1,150 @@
+#include <RcppArmadillo.h>
+
+#include "mdd.h"
+#include "msh.h"
+
+using namespace Rcpp;
+using namespace arma;
+
+
+/*______________________class mdd_harmonic______________________*/
+mdd_harmonic::mdd_harmonic (
+    const int           SS_,
+    const bool          on_
+) : on(on_), SS(SS_) {
+  
+  batch_size        = SS >= 60 ? SS / 30 : 0;
+  log_max.set_size(31);
+  log_max.fill(-datum::inf);
+  sum_exp           = zeros(31);
+  count             = zeros(31);
+} // END mdd_harmonic
+
+
+
+void mdd_harmonic::add (
+    const int           ss,
+    const double        log_likelihood
+) {
+  if ( !on ) return;
+  
+  const double  x     = -log_likelihood;
+  const int     batch = batch_size > 0 ? ss / batch_size : 30;
+  
+  // the draws beyond the 30 batches of batch_size draws count only in the total
+  for (int i : {0, batch + 1}) {
+    if ( i > 30 ) continue;
+    if ( x > log_max(i) ) {
+      sum_exp(i)      = sum_exp(i) * std::exp(log_max(i) - x) + 1;
+      log_max(i)      = x;
+    } else {
+      sum_exp(i)     += std::exp(x - log_max(i));
+    }
+    count(i)++;
+  }
+} // END add
+
+
+
+void mdd_harmonic::merge (
+    const mdd_harmonic& other
+) {
+  if ( !on ) return;
+  
+  for (int i=0; i<31; i++) {
+    if ( other.count(i) == 0 ) continue;
+    const double  m   = std::max(log_max(i), other.log_max(i));
+    sum_exp(i)        = sum_exp(i) * std::exp(log_max(i) - m) + other.sum_exp(i) * std::exp(other.log_max(i) - m);
+    log_max(i)        = m;
+    count(i)         += other.count(i);
+  }
+} // END merge
+
+
+
+Rcpp::List mdd_harmonic::state () const {
+  return List::create(
+    _["log_max"]      = log_max,
+    _["sum_exp"]      = sum_exp,
+    _["count"]        = count
+  );
+} // END state
+
+
+
+void mdd_harmonic::restore (
+    const Rcpp::List&   state
+) {
+  if ( !on ) return;
+  
+  log_max           = as<vec>(state["log_max"]);
+  sum_exp           = as<vec>(state["sum_exp"]);
+  count             = as<vec>(state["count"]);
+} // END restore
+
+
+
+SEXP mdd_harmonic::result () const {
+  if ( !on ) return R_NilValue;
+  
+  // log p(Y) = - log( mean( exp( - log-likelihood ) ) )
+  const vec     log_mdd     = -(log_max + log(sum_exp) - log(count));
+  
+  double        log_mdd_se  = NA_REAL;
+  vec           se_components;
+  if ( batch_size > 0 ) {
+    se_components           = log_mdd.tail(30);
+    log_mdd_se              = stddev(se_components, 1);
+  }
+  
+  return List::create(
+    _["log_mdd"]      = log_mdd(0),
+    _["log_mdd_se"]   = log_mdd_se,
+    _["components"]   = List::create(
+      _["se_components"]  = se_components,
+      _["draws"]          = count(0)
+    )
+  );
+} // END result
+
+
+
+/*______________________function log_likelihood_shocks______________________*/
+double log_likelihood_shocks (
+    const arma::mat&  U,
+    const arma::mat&  B,
+    const arma::mat&  sigma
+) {
+  const int     N     = U.n_rows;
+  const int     T     = U.n_cols;
+  
+  double        log_det_B, sign;
+  log_det(log_det_B, sign, B);
+  
+  double        out   = T * log_det_B - 0.5 * N * T * std::log(2.0 * M_PI);
+  if ( sigma.n_elem > 0 ) {
+    out              += - accu(log(sigma)) - 0.5 * accu(square(U / sigma));
+  } else {
+    out              += - 0.5 * accu(square(U));
+  }
+  return out;
+} // END log_likelihood_shocks
+
+
+
+/*______________________function log_likelihood_msh______________________*/
+double log_likelihood_msh (
+    const arma::mat&  U,
+    const arma::mat&  B,
+    const arma::mat&  sigma2,
+    const arma::mat&  PR_TR,
+    const arma::vec&  pi_0
+) {
+  const int     T     = U.n_cols;
+  
+  double        log_det_B, sign;
+  log_det(log_det_B, sign, B);
+  
+  mat           xi_t_t;
+  return T * log_det_B + filtering_msh(xi_t_t, U, sigma2, PR_TR, pi_0);
+} // END log_likelihood_msh
@@ -0,0 +1,53 @@
+#ifndef _MDD_H_
+#define _MDD_H_
+
+#include <RcppArmadillo.h>
+
+
+// The harmonic-mean estimator of the log marginal data density accumulated during sampling.
+// Every recorded draw ss = 0, ..., SS - 1 adds its log-likelihood to a running log-sum-exp of
+// minus the log-likelihoods, as log_mean would compute it from the stored values. The numerical
+// standard error is computed from that of 30 batches of consecutive draws, as in the verify_*
+// functions, and is not available for fewer than 60 draws. The accumulators of the chains run 
+// on separate threads are combined by merge.
+class mdd_harmonic {
+  public:
+    mdd_harmonic (const int SS, const bool on);
+    
+    bool  enabled () const    { return on; }
+    
+    void  add (const int ss, const double log_likelihood);
+    void  merge (const mdd_harmonic& other);
+    
+    Rcpp::List  state () const;               // for the checkpoints
+    void        restore (const Rcpp::List& state);
+    SEXP        result () const;              // NULL if not enabled
+    
+  private:
+    bool          on;
+    int           SS, batch_size;
+    arma::vec     log_max, sum_exp, count;    // for all the draws in element 0 and the batches in 1, ..., 30
+};
+
+
+// the log-likelihood T log|det(B)| + log N(U | 0, diag(sigma^2)) of the structural shocks 
+// U = B(Y - AX) with standard deviations sigma, or unit ones if sigma is empty
+double log_likelihood_shocks (
+    const arma::mat&  U,                // NxT
+    const arma::mat&  B,                // NxN
+    const arma::mat&  sigma             // NxT or empty
+);
+
+
+// the log-likelihood of the MSH and mixture models with the regimes integrated out by the 
+// Hamilton filter
+double log_likelihood_msh (
+    const arma::mat&  U,                // NxT
+    const arma::mat&  B,                // NxN
+    const arma::mat&  sigma2,           // NxM
+    const arma::mat&  PR_TR,            // MxM
+    const arma::vec&  pi_0              // Mx1
+);
+
+
+#endif  // _MDD_H_
@@ -2,7 +2,8 @@
 #include <RcppArmadillo.h>
 #include "Rcpp/Rmath.h"
 
-#include "sample.h"
+#include "prior.h"
+#include "rng.h"
 
 using namespace Rcpp;
 using namespace arma;
@@ -52,7 +53,7 @@ arma::rowvec rDirichlet1 (
   const int K   = alpha.size();
   rowvec    draw(K);
   for (int k=0; k<K; k++) {
-    draw(k)     = randg(distr_param(alpha(k), 1.0));
+    draw(k)     = rng_randg(alpha(k), 1.0);
   }
   return draw/sum(draw);
 } // END rDirichlet1
@@ -68,51 +69,102 @@ arma::rowvec rIG2_Dirichlet1 (
   const int   M     = s.n_cols;
   rowvec      draw  = s;
   for (int m=0; m<M; m++) {
-    draw(m)        /= chi2rnd(nu(m));
+    draw(m)        /= rng_chi2rnd(nu(m));
   }
   return draw/sum(draw);
 } // END rIG2_Dirichlet1
 
 
 
-// [[Rcpp::interfaces(cpp, r)]]
-// [[Rcpp::export]]
-arma::mat filtering_msh (
+double filtering_msh (
+  arma::mat&        xi_t_t,             // MxT filtered probabilities, filled by the function
   const arma::mat&  U,                  // NxT
   const arma::mat&  sigma,              // NxM
   const arma::mat&  PR_TR,              // MxM
   const arma::vec&  pi_0                // Mx1
 ) {
+  // the Hamilton filter with the densities scaled by their maximum at every t
+  // computed in one pass over U; returns the log-likelihood log p(U | sigma, PR_TR, pi_0)
   const int   T = U.n_cols;
   const int   N = U.n_rows;
   const int   M = PR_TR.n_rows;
   
-  mat         eta_t(M, T);
-  mat         xi_t_t(M, T);
-  
-  // This loop evaluates mvnormal pdf at U - simplified operations for zero-mean diagonal-covariance case
-  for (int m=0; m<M; m++) {
-    rowvec log_d    = -0.5 * sum(pow( pow(sigma.col(m), -0.5) % U.each_col(), 2), 0);
-    log_d          += -0.5 * N * log(2*M_PI) - 0.5 * log(prod(sigma.col(m)));
-    NumericVector   exp_log_d   = wrap(exp(log_d));
-    exp_log_d[exp_log_d==0]     = 1e-300;
-    eta_t.row(m)    = as<rowvec>(exp_log_d);
-  } // END m loop
+  const mat     sigma_inv   = trans(1 / sigma);     // MxN, column n contiguous over m
+  const rowvec  log_const   = -0.5 * N * log(2*M_PI) - 0.5 * sum(log(sigma), 0);
   
-  vec xi_tm1_tm1    = pi_0;
+  xi_t_t.set_size(M, T);
+  vec         pred(M);
+  double      log_likelihood  = 0;
   
   for (int t=0; t<T; t++) {
-    vec     num     = eta_t.col(t) % (PR_TR.t() * xi_tm1_tm1);
-    double  den     = sum(num);
-    xi_t_t.col(t)   = num/den;
-    xi_tm1_tm1      = xi_t_t.col(t);
+    double*       xi_t    = xi_t_t.colptr(t);
+    const double* xi_tm1  = t == 0 ? pi_0.memptr() : xi_t_t.colptr(t-1);
+    const double* u_t     = U.colptr(t);
+    
+    // log densities of the zero-mean diagonal-covariance normal for all regimes
+    for (int m=0; m<M; m++) xi_t[m] = 0;
+    for (int n=0; n<N; n++) {
+      const double  u2      = u_t[n] * u_t[n];
+      const double* s_inv_n = sigma_inv.colptr(n);
+      for (int m=0; m<M; m++) xi_t[m] += u2 * s_inv_n[m];
+    }
+    double  log_d_max     = -datum::inf;
+    for (int m=0; m<M; m++) {
+      xi_t[m]             = log_const(m) - 0.5 * xi_t[m];
+      log_d_max           = std::max(log_d_max, xi_t[m]);
+    }
+    
+    // predicted probabilities PR_TR' * xi_tm1 and the update
+    double  den           = 0;
+    for (int m=0; m<M; m++) {
+      const double* PR_TR_m = PR_TR.colptr(m);
+      pred(m)             = 0;
+      for (int i=0; i<M; i++) pred(m) += PR_TR_m[i] * xi_tm1[i];
+      xi_t[m]             = std::exp(std::max(xi_t[m] - log_d_max, -690.0)) * pred(m);
+      den                += xi_t[m];
+    }
+    for (int m=0; m<M; m++) xi_t[m] /= den;
+    log_likelihood       += log_d_max + std::log(den);
   } // END t loop
+  
+  return log_likelihood;
+} // END filtering_msh
+
 
+
+// [[Rcpp::interfaces(cpp, r)]]
+// [[Rcpp::export]]
+arma::mat filtering_msh (
+  const arma::mat&  U,                  // NxT
+  const arma::mat&  sigma,              // NxM
+  const arma::mat&  PR_TR,              // MxM
+  const arma::vec&  pi_0                // Mx1
+) {
+  mat         xi_t_t;
+  filtering_msh(xi_t_t, U, sigma, PR_TR, pi_0);
   return xi_t_t;
 } // END filtering_msh
 
 
 
+// [[Rcpp::interfaces(cpp, r)]]
+// [[Rcpp::export]]
+Rcpp::List filtering_msh_loglik (
+  const arma::mat&  U,                  // NxT
+  const arma::mat&  sigma,              // NxM
+  const arma::mat&  PR_TR,              // MxM
+  const arma::vec&  pi_0                // Mx1
+) {
+  mat         xi_t_t;
+  double      log_likelihood  = filtering_msh(xi_t_t, U, sigma, PR_TR, pi_0);
+  return List::create(
+    _["filtered"]       = xi_t_t,
+    _["log_likelihood"] = log_likelihood
+  );
+} // END filtering_msh_loglik
+
+
+
 // [[Rcpp::interfaces(cpp, r)]]
 // [[Rcpp::export]]
 arma::mat smoothing_msh (
@@ -124,11 +176,29 @@ arma::mat smoothing_msh (
   const int   M = PR_TR.n_rows;
   
   mat   smoothed(M, T);
+  vec   ratio(M);
   smoothed.col(T-1)   = filtered.col(T-1);
   
   for (int t=T-2; t>=0; --t) {
-    smoothed.col(t)   = (PR_TR * (smoothed.col(t+1)/(PR_TR.t() * filtered.col(t)) )) % filtered.col(t);
-    if (any(smoothed.col(t) < 0) || any(smoothed.col(t) > 1)) {
+    const double* f_t = filtered.colptr(t);
+    const double* s_p = smoothed.colptr(t+1);
+    double*       s_t = smoothed.colptr(t);
+    
+    // ratio = smoothed_t+1 / (PR_TR' * filtered_t), then smoothed_t = (PR_TR * ratio) % filtered_t
+    for (int m=0; m<M; m++) {
+      const double* PR_TR_m = PR_TR.colptr(m);
+      double  pred      = 0;
+      for (int i=0; i<M; i++) pred += PR_TR_m[i] * f_t[i];
+      ratio(m)          = s_p[m] / pred;
+    }
+    bool    outside     = false;
+    for (int m=0; m<M; m++) {
+      double  acc       = 0;
+      for (int j=0; j<M; j++) acc += PR_TR(m, j) * ratio(j);
+      s_t[m]            = acc * f_t[m];
+      outside           = outside || s_t[m] < 0 || s_t[m] > 1;
+    }
+    if ( outside ) {
       for (int m=0; m<M; m++) {
         if (smoothed(m,t) > 1) {smoothed(m,t) = 1;}
         if (smoothed(m,t) < 0) {smoothed(m,t) = 0;}
@@ -142,6 +212,32 @@ arma::mat smoothing_msh (
 
 
 
+arma::urowvec sample_regime_path (
+    const arma::mat&  filtered,           // MxT
+    const arma::mat&  PR_TR               // MxM
+) {
+  // a draw of the regime path, coded 0, ..., M-1, in one backward pass: the last regime 
+  // from the filtered probabilities at T and the regime at t with probabilities 
+  // proportional to filtered.col(t) % PR_TR.col(regime at t+1)
+  const int   M   = filtered.n_rows;
+  const int   T   = filtered.n_cols;
+  
+  urowvec     path(T);
+  vec         prob(M);
+  path(T-1)       = rng_categorical(filtered.colptr(T-1), M);
+  for (int t=T-2; t>=0; --t) {
+    const double* f_t     = filtered.colptr(t);
+    const double* PR_TR_s = PR_TR.colptr(path(t+1));
+    for (int m=0; m<M; m++) {
+      prob(m)     = f_t[m] * PR_TR_s[m];
+    }
+    path(t)       = rng_categorical(prob.memptr(), M);
+  }
+  return path;
+} // END sample_regime_path
+
+
+
 // [[Rcpp::interfaces(cpp, r)]]
 // [[Rcpp::export]]
 arma::mat sample_Markov_process_msh (
@@ -163,38 +259,28 @@ arma::mat sample_Markov_process_msh (
   
   const int   T   = U.n_cols;
   const int   M   = aux_PR_TR.n_rows;
-  mat aux_xi_tmp  = aux_xi;
-  
-  mat filtered    = filtering_msh(U, aux_sigma2, aux_PR_TR, aux_pi_0);
-  mat smoothed    = smoothing_msh(U, aux_PR_TR, filtered);
-  mat     aj      = eye(M, M);
+  mat aux_xi_tmp(M, T);
   
-  mat xi(M, T);
-  int draw        = csample_num1(wrap(seq_len(M)), wrap(smoothed.col(T-1)));
-  aux_xi_tmp.col(T-1)     = aj.col(draw-1);
+  // the smoothed probabilities at T are the filtered ones, so no smoothing pass is needed
+  mat filtered;
+  filtering_msh(filtered, U, aux_sigma2, aux_PR_TR, aux_pi_0);
   
-  if ( minimum_regime_occurrences==0 ) {
-    for (int t=T-2; t>=0; --t) {
-      vec xi_Tmj    = (aux_PR_TR * (aux_xi.col(t+1)/(aux_PR_TR.t() * filtered.col(t)))) % filtered.col(t);
-      draw          = csample_num1(wrap(seq_len(M)), wrap(xi_Tmj));
-      aux_xi_tmp.col(t)   = aj.col(draw-1);
+  int regime_occurrences  = minimum_regime_occurrences;
+  int iterations  = 0;
+  do {
+    urowvec path          = sample_regime_path(filtered, aux_PR_TR);
+    aux_xi_tmp.zeros();
+    for (int t=0; t<T; t++) {
+      aux_xi_tmp(path(t), t) = 1;
     }
-    aux_xi = aux_xi_tmp;
-  } else {
-    int regime_occurrences  = 1;
-    int iterations  = 1;
-    while ( (regime_occurrences<minimum_regime_occurrences) & (iterations<max_iterations) ) {
-      for (int t=T-2; t>=0; --t) {
-        vec xi_Tmj    = (aux_PR_TR * (aux_xi.col(t+1)/(aux_PR_TR.t() * filtered.col(t)))) % filtered.col(t);
-        draw          = csample_num1(wrap(seq_len(M)), wrap(xi_Tmj));
-        aux_xi_tmp.col(t)   = aj.col(draw-1);
-      }
-      mat transitions       = count_regime_transitions(aux_xi_tmp);
-      regime_occurrences    = min(transitions.diag());
-      iterations++;
-    } // END while
-    if ( iterations<max_iterations ) aux_xi = aux_xi_tmp;
-  }
+    if ( minimum_regime_occurrences > 0 ) {
+      mat transitions     = count_regime_transitions(aux_xi_tmp);
+      regime_occurrences  = min(transitions.diag());
+    }
+    iterations++;
+  } while ( (regime_occurrences<minimum_regime_occurrences) & (iterations<max_iterations) );
+  
+  if ( regime_occurrences>=minimum_regime_occurrences ) aux_xi = aux_xi_tmp;
   
   return aux_xi;
 } // END sample_Markov_process_msh
@@ -203,16 +289,71 @@ arma::mat sample_Markov_process_msh (
 
 // [[Rcpp::interfaces(cpp, r)]]
 // [[Rcpp::export]]
-Rcpp::List sample_transition_probabilities (
-    arma::mat           aux_PR_TR,    // MxM 
-    arma::vec           aux_pi_0,     // Mx1
+arma::mat sample_mixture_regimes (
+    arma::mat&        aux_xi,             // MxT
+    const arma::mat&  U,                  // NxT
+    const arma::mat&  aux_sigma2,         // NxM
+    const arma::vec&  aux_pi_0,           // Mx1
+    const bool        finiteM = true
+) {
+  // the function changes the value of aux_xi by reference (filling it with a new draw)
+  // the indicators of the mixture are independent over t given the shocks, so they are
+  // drawn at once from the probabilities proportional to pi_0 % N(u_t | 0, diag(sigma2))
+  // computed for all t by one matrix product, with no filtering or smoothing
+  const int   T   = U.n_cols;
+  const int   M   = aux_sigma2.n_cols;
+
+  mat prob        = - 0.5 * trans(1 / aux_sigma2) * square(U);                // MxT
+  prob.each_col()+= log(aux_pi_0) - 0.5 * trans(sum(log(aux_sigma2), 0));
+  prob.each_row()-= max(prob, 0);
+  prob            = exp(prob);
+
+  urowvec regime(T);
+  for (int t=0; t<T; t++) {
+    regime(t)     = rng_categorical(prob.colptr(t), M);
+  }
+
+  // with finitely many regimes every one of them occurs at least twice; a draw violating
+  // this is replaced by a sweep over t from the current indicators, in which the indicator
+  // at t is redrawn unless its regime occurs only twice, which targets the draws that
+  // preserve the bound instead of redrawing the whole path
+  if ( finiteM ) {
+    const int minimum_regime_occurrences = 2;
+    ivec  occurrences(M, fill::zeros);
+    for (int t=0; t<T; t++) occurrences(regime(t))++;
+    if ( min(occurrences) < minimum_regime_occurrences ) {
+      regime            = index_max(aux_xi, 0);
+      occurrences.zeros();
+      for (int t=0; t<T; t++) occurrences(regime(t))++;
+      for (int t=0; t<T; t++) {
+        if ( occurrences(regime(t)) <= minimum_regime_occurrences ) continue;
+        occurrences(regime(t))--;
+        regime(t)       = rng_categorical(prob.colptr(t), M);
+        occurrences(regime(t))++;
+      }
+    }
+  }
+
+  aux_xi.zeros(M, T);
+  for (int t=0; t<T; t++) {
+    aux_xi(regime(t), t) = 1;
+  }
+
+  return aux_xi;
+} // END sample_mixture_regimes
+
+
+
+void sample_transition_probabilities (
+    arma::mat&          aux_PR_TR,    // MxM 
+    arma::vec&          aux_pi_0,     // Mx1
     const arma::mat&    aux_xi,       // MxT
-    const Rcpp::List&   prior,         // a list of priors - original dimensions
-    const bool          MSnotMIX = true
+    const bsvar_prior&  prior,        // priors converted by read_prior
+    const bool          MSnotMIX
 ) {
   // the function changes the value of aux_PR_TR and aux_pi_0 by reference (filling it with a new draw)
   const int   M           = aux_PR_TR.n_rows;
-  const mat   prior_PR_TR = as<mat>(prior["PR_TR"]);
+  const mat&  prior_PR_TR = prior.PR_TR;
   
   if ( MSnotMIX ) {
     mat transitions       = count_regime_transitions(aux_xi);
@@ -223,9 +364,9 @@ Rcpp::List sample_transition_probabilities (
     }
     vec prob_xi1          = aux_PR_TR *aux_xi.col(0);
     prob_xi1             /= sum(prob_xi1);
-    int S0_draw           = csample_num1(wrap(seq_len(M)), wrap(prob_xi1));
+    int S0_draw           = rng_categorical(prob_xi1);
     rowvec posterior_alpha_0(M, fill::value((1.0)));
-    posterior_alpha_0(S0_draw-1)++;
+    posterior_alpha_0(S0_draw)++;
     aux_pi_0              = trans(rDirichlet1(posterior_alpha_0));
   } else {
     rowvec occurrences    = trans(sum(aux_xi, 1));
@@ -235,6 +376,22 @@ Rcpp::List sample_transition_probabilities (
       aux_PR_TR.row(m)    = aux_pi_0.t();
     }
   }
+} // END sample_transition_probabilities
+
+
+
+// [[Rcpp::interfaces(cpp, r)]]
+// [[Rcpp::export]]
+Rcpp::List sample_transition_probabilities (
+    arma::mat           aux_PR_TR,    // MxM 
+    arma::vec           aux_pi_0,     // Mx1
+    const arma::mat&    aux_xi,       // MxT
+    const Rcpp::List&   prior,         // a list of priors - original dimensions
+    const bool          MSnotMIX = true
+) {
+  bsvar_prior prior_;
+  prior_.PR_TR            = as<mat>(prior["PR_TR"]);
+  sample_transition_probabilities(aux_PR_TR, aux_pi_0, aux_xi, prior_, MSnotMIX);
   
   return List::create(
     _["PR_TR"]        = aux_PR_TR,
@@ -244,8 +401,6 @@ Rcpp::List sample_transition_probabilities (
 
 
 
-// [[Rcpp::interfaces(cpp, r)]]
-// [[Rcpp::export]]
 arma::mat sample_variances_msh (
     arma::mat&          aux_sigma2, // NxM
     const arma::mat&    aux_B,      // NxN
@@ -253,23 +408,20 @@ arma::mat sample_variances_msh (
     const arma::mat&    Y,          // NxT dependent variables
     const arma::mat&    X,          // KxT explanatory variables
     const arma::mat&    aux_xi,     // MxT state variables
-    const Rcpp::List&   prior       // a list of priors - original dimensions
+    const bsvar_prior&  prior       // priors converted by read_prior
 ) {
   // the function changes the value of aux_sigma2 by reference (filling it with a new draw)
   const int   M     = aux_xi.n_rows;
   const int   N     = aux_B.n_rows;
-  const int   T     = Y.n_cols;
   const double MM   = M;
   
-  rowvec posterior_nu   = sum(aux_xi, 1).t() + as<double>(prior["sigma_nu"]);
+  rowvec posterior_nu   = sum(aux_xi, 1).t() + prior.sigma_nu;
   mat posterior_s(N, M);
-  posterior_s.fill(prior["sigma_s"]);
+  posterior_s.fill(prior.sigma_s);
+  const mat U           = aux_B * (Y - aux_A * X);
+  const urowvec regime  = index_max(aux_xi, 0);
   for (int m=0; m<M; m++) {
-    for (int t=0; t<T; t++) {
-      if (aux_xi(m,t)==1) {
-        posterior_s.col(m) += square(aux_B * (Y.col(t) - aux_A * X.col(t)));
-      }
-    }
+    posterior_s.col(m) += sum(square(U.cols(find(regime == m))), 1);
   }
   // This is the version with restriction sum(aux_sigma2,0) = M
   for (int n=0; n<N; n++) {
@@ -279,3 +431,22 @@ arma::mat sample_variances_msh (
   return aux_sigma2;
 } // END sample_variances_msh
 
+
+
+// [[Rcpp::interfaces(cpp, r)]]
+// [[Rcpp::export]]
+arma::mat sample_variances_msh (
+    arma::mat&          aux_sigma2, // NxM
+    const arma::mat&    aux_B,      // NxN
+    const arma::mat&    aux_A,      // NxK
+    const arma::mat&    Y,          // NxT dependent variables
+    const arma::mat&    X,          // KxT explanatory variables
+    const arma::mat&    aux_xi,     // MxT state variables
+    const Rcpp::List&   prior       // a list of priors - original dimensions
+) {
+  bsvar_prior prior_;
+  prior_.sigma_nu       = as<double>(prior["sigma_nu"]);
+  prior_.sigma_s        = as<double>(prior["sigma_s"]);
+  return sample_variances_msh(aux_sigma2, aux_B, aux_A, Y, X, aux_xi, prior_);
+} // END sample_variances_msh
+
@@ -4,6 +4,8 @@
 
 #include <RcppArmadillo.h>
 
+#include "prior.h"
+
 
 
 arma::vec Ergodic_PR_TR (
@@ -27,6 +29,15 @@ arma::rowvec rIG2_Dirichlet1 (
 );
 
 
+double filtering_msh (
+    arma::mat&        xi_t_t,         // MxT filtered probabilities, filled by the function
+    const arma::mat&  U,              // NxT
+    const arma::mat&  sigma,          // NxM
+    const arma::mat&  PR_TR,          // MxM
+    const arma::vec&  pi_0            // Mx1
+);
+
+
 arma::mat filtering_msh (
     const arma::mat&  U,              // NxT
     const arma::mat&  sigma,          // NxM
@@ -35,6 +46,14 @@ arma::mat filtering_msh (
 );
 
 
+Rcpp::List filtering_msh_loglik (
+    const arma::mat&  U,              // NxT
+    const arma::mat&  sigma,          // NxM
+    const arma::mat&  PR_TR,          // MxM
+    const arma::vec&  pi_0            // Mx1
+);
+
+
 arma::mat smoothing_msh (
     const arma::mat&  U,              // NxT
     const arma::mat&  PR_TR,          // MxM
@@ -42,6 +61,12 @@ arma::mat smoothing_msh (
 );
 
 
+arma::urowvec sample_regime_path (
+    const arma::mat&  filtered,           // MxT
+    const arma::mat&  PR_TR               // MxM
+);
+
+
 arma::mat sample_Markov_process_msh (
     arma::mat&        aux_xi,             // MxT
     const arma::mat&  U,                  // NxT
@@ -52,6 +77,15 @@ arma::mat sample_Markov_process_msh (
 );
 
 
+arma::mat sample_mixture_regimes (
+    arma::mat&        aux_xi,             // MxT
+    const arma::mat&  U,                  // NxT
+    const arma::mat&  aux_sigma2,         // NxM
+    const arma::vec&  aux_pi_0,           // Mx1
+    const bool        finiteM = true
+);
+
+
 Rcpp::List sample_transition_probabilities (
     arma::mat           aux_PR_TR,    // MxM 
     arma::vec           aux_pi_0,     // Mx1
@@ -60,6 +94,14 @@ Rcpp::List sample_transition_probabilities (
     const bool          MSnotMIX = true
 );
 
+void sample_transition_probabilities (
+    arma::mat&          aux_PR_TR,    // MxM 
+    arma::vec&          aux_pi_0,     // Mx1
+    const arma::mat&    aux_xi,       // MxT
+    const bsvar_prior&  prior,        // priors converted by read_prior
+    const bool          MSnotMIX = true
+);
+
 
 arma::mat sample_variances_msh (
     arma::mat&          aux_sigma2, // NxM
@@ -71,5 +113,15 @@ arma::mat sample_variances_msh (
     const Rcpp::List&   prior       // a list of priors - original dimensions
 );
 
+arma::mat sample_variances_msh (
+    arma::mat&          aux_sigma2, // NxM
+    const arma::mat&    aux_B,      // NxN
+    const arma::mat&    aux_A,      // NxK
+    const arma::mat&    Y,          // NxT dependent variables
+    const arma::mat&    X,          // KxT explanatory variables
+    const arma::mat&    aux_xi,     // MxT state variables
+    const bsvar_prior&  prior       // priors converted by read_prior
+);
+
 
 #endif  // _MSH_H_
\ No newline at end of file
@@ -1,11 +1,31 @@
-
 #include <RcppArmadillo.h>
 #include "Rcpp/Rmath.h"
 
+#include "parallel.h"
+
 using namespace Rcpp;
 using namespace arma;
 
 
+/*______________________function normalisation_wz2003_signs______________________*/
+// flipping the sign of row n of B flips the sign of column n of B^{-1}, so the distance
+// sum_n (d_n b_n - h_n)' Sigma_inv (d_n b_n - h_n) between the columns b_n of B^{-1} and 
+// h_n of B_hat^{-1} is separable in the signs d_n and minimised by d_n = sign(b_n' Sigma_inv h_n)
+arma::rowvec normalisation_wz2003_signs (
+    const arma::mat& B_inv,               // NxN
+    const arma::mat& B_hat_inv,           // NxN
+    const arma::mat& Sigma_inv            // NxN
+) {
+  const rowvec  cross   = sum(B_inv % (Sigma_inv * B_hat_inv), 0);    // 1xN b_n' Sigma_inv h_n
+  rowvec        out(B_inv.n_cols);
+  for (uword n=0; n<B_inv.n_cols; n++) {
+    out(n)              = cross(n) > 0 ? 1 : -1;
+  }
+  return out;
+} // END normalisation_wz2003_signs
+
+
+
 /*______________________function normalisation_wz2003_s______________________*/
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
@@ -15,16 +35,20 @@ arma::rowvec normalisation_wz2003_s (
     const arma::mat& Sigma_inv,           // NxN
     const arma::mat& diag_signs           // KxN
 ) {
-  // returns a rowvec of signs
+  // returns the row of diag_signs minimising the distance; B is inverted once and 
+  // the distance of every sign combination is evaluated from the separable terms
   const int N         = B.n_rows;
-  const int K         = pow(2,N);
+  const int K         = diag_signs.n_rows;
+  
+  const mat     B_inv   = inv(B);
+  const rowvec  cross   = sum(B_inv % (Sigma_inv * B_hat_inv), 0);    // 1xN
+  const double  common  = accu(B_inv % (Sigma_inv * B_inv)) + accu(B_hat_inv % (Sigma_inv * B_hat_inv));
   vec       distance(K);
   
   for (int k=0; k<K; k++) {
-    mat   B_tmp_inv   = inv(diagmat(diag_signs.row(k)) * B);
-    mat   dist_tmp    = trans(B_tmp_inv - B_hat_inv);
+    distance(k)       = common;
     for (int n=0; n<N; n++) {
-      distance(k)     += as_scalar(dist_tmp.row(n) * Sigma_inv * trans(dist_tmp.row(n)));
+      distance(k)    -= 2 * diag_signs(k, n) * cross(n);
     } // END n loop
   } // END k loop
   
@@ -37,30 +61,26 @@ arma::rowvec normalisation_wz2003_s (
 // [[Rcpp::export]]
 void normalisation_wz2003 (
     arma::cube&       posterior_B,            // NxNxS
-    const arma::mat&  B_hat              // NxN
+    const arma::mat&  B_hat,             // NxN
+    const int         threads = 1
 ) {
   // changes posterior_B by reference filling it with normalised values
-  const int   N       = posterior_B.n_rows;
-  const int   K       = pow(2, N);
   const int   S       = posterior_B.n_slices;
   
   mat B_hat_inv       = inv(B_hat);
   mat Sigma_inv       = B_hat.t() * B_hat;
   
-  // create matrix diag_signs whose rows contain all sign combinations
-  mat diag_signs(K, N);
-  vec omo             = as<vec>(NumericVector::create(-1,1));
-  for (int n=0; n<N; n++) {
-    vec os(pow(2, n), fill::ones);
-    vec oos(pow(2, N-1-n), fill::ones);
-    diag_signs.col(n) = kron(os, kron(omo, oos));
-  }
-  
   // normalisation
+  parallel_error  error;
+  
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
   for (int s=0; s<S; s++) {
-    rowvec sss            = normalisation_wz2003_s(posterior_B.slice(s), B_hat_inv, Sigma_inv, diag_signs);
-    mat B_norm            = diagmat(sss) * posterior_B.slice(s);
-    posterior_B.slice(s)   = B_norm;
+    try {
+      rowvec sss            = normalisation_wz2003_signs(inv(posterior_B.slice(s)), B_hat_inv, Sigma_inv);
+      posterior_B.slice(s)  = posterior_B.slice(s).each_col() % sss.t();
+    } catch (std::exception& e) {
+      error.record(e);
+    }
   }
+  error.rethrow();
 } // END normalisation_wz2003
-
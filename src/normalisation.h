@@ -4,6 +4,14 @@
 
 #include <RcppArmadillo.h>
 
+
+arma::rowvec normalisation_wz2003_signs (
+    const arma::mat& B_inv,               // NxN
+    const arma::mat& B_hat_inv,           // NxN
+    const arma::mat& Sigma_inv            // NxN
+);
+
+
 arma::rowvec normalisation_wz2003_s (
     const arma::mat& B,                   // NxN
     const arma::mat& B_hat_inv,           // NxN
@@ -14,7 +22,8 @@ arma::rowvec normalisation_wz2003_s (
 
 void normalisation_wz2003 (
     arma::cube& posterior_B,            // NxNxS
-    const arma::mat& B_hat              // NxN
+    const arma::mat& B_hat,             // NxN
+    const int        threads = 1
 );
 
 #endif  // _NORMALISATION_H_
\ No newline at end of file
@@ -0,0 +1,33 @@
+
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+#include <RcppArmadillo.h>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+// Worker threads must not call the R API, so an exception thrown inside
+// a parallel region is stored and reported from the main thread afterwards
+class parallel_error {
+  public:
+    void record (const std::exception& e) {
+      #pragma omp critical(bsvars_parallel_error)
+      {
+        if (message.empty()) message = e.what();
+      }
+    }
+
+    void rethrow () const {
+      if (!message.empty()) Rcpp::stop(message);
+    }
+
+  private:
+    std::string message;
+};
+
+
+#endif  // _PARALLEL_H_
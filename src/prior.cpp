@@ -0,0 +1,38 @@
+#include <RcppArmadillo.h>
+
+#include "prior.h"
+
+using namespace Rcpp;
+using namespace arma;
+
+
+
+/*______________________function read_prior______________________*/
+bsvar_prior read_prior (
+    const Rcpp::List& prior
+) {
+  bsvar_prior out;
+
+  if ( prior.containsElementNamed("A") )            out.A           = as<mat>(prior["A"]);
+  if ( prior.containsElementNamed("A_V_inv") )      out.A_V_inv     = as<mat>(prior["A_V_inv"]);
+  if ( prior.containsElementNamed("B_V_inv") )      out.B_V_inv     = as<mat>(prior["B_V_inv"]);
+  if ( prior.containsElementNamed("B_nu") )         out.B_nu        = as<int>(prior["B_nu"]);
+
+  if ( prior.containsElementNamed("hyper_nu_B") )   out.hyper_nu_B  = as<double>(prior["hyper_nu_B"]);
+  if ( prior.containsElementNamed("hyper_a_B") )    out.hyper_a_B   = as<double>(prior["hyper_a_B"]);
+  if ( prior.containsElementNamed("hyper_s_BB") )   out.hyper_s_BB  = as<double>(prior["hyper_s_BB"]);
+  if ( prior.containsElementNamed("hyper_nu_BB") )  out.hyper_nu_BB = as<double>(prior["hyper_nu_BB"]);
+  if ( prior.containsElementNamed("hyper_nu_A") )   out.hyper_nu_A  = as<double>(prior["hyper_nu_A"]);
+  if ( prior.containsElementNamed("hyper_a_A") )    out.hyper_a_A   = as<double>(prior["hyper_a_A"]);
+  if ( prior.containsElementNamed("hyper_s_AA") )   out.hyper_s_AA  = as<double>(prior["hyper_s_AA"]);
+  if ( prior.containsElementNamed("hyper_nu_AA") )  out.hyper_nu_AA = as<double>(prior["hyper_nu_AA"]);
+
+  if ( prior.containsElementNamed("sv_a_") )        out.sv_a_       = as<double>(prior["sv_a_"]);
+  if ( prior.containsElementNamed("sv_s_") )        out.sv_s_       = as<double>(prior["sv_s_"]);
+
+  if ( prior.containsElementNamed("PR_TR") )        out.PR_TR       = as<mat>(prior["PR_TR"]);
+  if ( prior.containsElementNamed("sigma_nu") )     out.sigma_nu    = as<double>(prior["sigma_nu"]);
+  if ( prior.containsElementNamed("sigma_s") )      out.sigma_s     = as<double>(prior["sigma_s"]);
+
+  return out;
+} // END read_prior
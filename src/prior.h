@@ -0,0 +1,40 @@
+
+#ifndef _PRIOR_H_
+#define _PRIOR_H_
+
+#include <RcppArmadillo.h>
+
+
+// The prior hyper-parameters converted from the R list once so that the
+// samplers can use them without calls to the R API, e.g. on worker threads.
+// Only the fields present in the list are filled.
+struct bsvar_prior {
+  arma::mat   A;                  // NxK
+  arma::mat   A_V_inv;            // KxK
+  arma::mat   B_V_inv;            // NxN
+  int         B_nu        = 0;
+
+  double      hyper_nu_B  = 0;
+  double      hyper_a_B   = 0;
+  double      hyper_s_BB  = 0;
+  double      hyper_nu_BB = 0;
+  double      hyper_nu_A  = 0;
+  double      hyper_a_A   = 0;
+  double      hyper_s_AA  = 0;
+  double      hyper_nu_AA = 0;
+
+  double      sv_a_       = 0;    // SV models
+  double      sv_s_       = 0;
+
+  arma::mat   PR_TR;              // MxM, MSH models
+  double      sigma_nu    = 0;
+  double      sigma_s     = 0;
+};
+
+
+bsvar_prior read_prior (
+    const Rcpp::List& prior           // a list of priors - original dimensions
+);
+
+
+#endif  // _PRIOR_H_
@@ -0,0 +1,64 @@
+#include <RcppArmadillo.h>
+
+#include "residuals.h"
+
+using namespace Rcpp;
+using namespace arma;
+
+
+/*______________________class residual_engine______________________*/
+residual_engine::residual_engine (
+    const arma::cube&   posterior_A_,
+    const arma::mat&    X_
+) : posterior_A(posterior_A_), X(X_), current(-1) {
+  
+  N                 = posterior_A.n_rows;
+  S                 = posterior_A.n_slices;
+  const int   size_s  = std::max(N * (int)X.n_cols, 1);
+  block             = std::max(1, std::min(S, (1 << 22) / size_s));
+  n_blocks          = (S + block - 1) / block;
+  A_stacked.set_size(N * block, posterior_A.n_cols);
+} // END residual_engine
+
+
+
+void residual_engine::compute (
+    const int           b
+) {
+  const int   size_b  = last(b) - first(b);
+  for (int i=0; i<size_b; i++) {
+    A_stacked.rows(i * N, (i + 1) * N - 1) = posterior_A.slice(first(b) + i);
+  } // END i loop
+  
+  AX                = A_stacked.head_rows(N * size_b) * X;
+  current           = b;
+} // END compute
+
+
+
+arma::mat residual_engine::mean (
+    const int           s
+) const {
+  const int   i       = s - first(current);
+  return AX.rows(i * N, (i + 1) * N - 1);
+} // END mean
+
+
+
+arma::mat residual_engine::residuals (
+    const int           s,
+    const arma::mat&    Y
+) const {
+  const int   i       = s - first(current);
+  return Y - AX.rows(i * N, (i + 1) * N - 1);
+} // END residuals
+
+
+
+arma::mat residual_engine::shocks (
+    const int           s,
+    const arma::mat&    B,
+    const arma::mat&    Y
+) const {
+  return B * residuals(s, Y);
+} // END shocks
@@ -0,0 +1,35 @@
+#ifndef _RESIDUALS_H_
+#define _RESIDUALS_H_
+
+#include <RcppArmadillo.h>
+
+
+// The reduced-form means A_s X of the posterior draws of A, computed for blocks of draws by
+// one product of the matrices A_s of the block stacked by rows with X instead of one small
+// product per draw. A block of at most 2^22 values is kept at a time. compute(b) is called
+// on the main thread, and mean, residuals, and shocks for the draws of block b may then be
+// called on worker threads.
+class residual_engine {
+  public:
+    residual_engine (const arma::cube& posterior_A, const arma::mat& X);
+    
+    int   blocks () const               { return n_blocks; }
+    int   first (const int b) const     { return b * block; }
+    int   last (const int b) const      { return std::min((b + 1) * block, S); }  // one past the last draw
+    
+    void  compute (const int b);        // the means of the draws of block b
+    
+    arma::mat   mean (const int s) const;                                // A_s X
+    arma::mat   residuals (const int s, const arma::mat& Y) const;      // Y - A_s X
+    arma::mat   shocks (const int s, const arma::mat& B, const arma::mat& Y) const; // B (Y - A_s X)
+    
+  private:
+    const arma::cube&   posterior_A;
+    const arma::mat&    X;
+    int                 N, S, block, n_blocks, current;
+    arma::mat           A_stacked;      // (N * block, K)
+    arma::mat           AX;             // (N * block, T)
+};
+
+
+#endif  // _RESIDUALS_H_
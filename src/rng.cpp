@@ -0,0 +1,456 @@
+#include <RcppArmadillo.h>
+#include "Rcpp/Rmath.h"
+#include <RcppTN.h>
+#include <iomanip>
+#include <sstream>
+
+#include "sv.h"
+#include "rng.h"
+
+using namespace Rcpp;
+using namespace arma;
+
+
+static thread_local rng_stream* attached_stream = nullptr;
+
+
+
+/*______________________class rng_stream______________________*/
+rng_stream::rng_stream (
+    const uint64_t  seed
+) {
+  std::seed_seq seq { uint32_t(seed >> 32), uint32_t(seed & 0xffffffff) };
+  engine.seed(seq);
+  has_spare_norm  = false;
+  spare_norm      = 0;
+} // END rng_stream
+
+
+double rng_stream::unif () {
+  // 53 random bits shifted by half a step so that neither 0 nor 1 is returned
+  return ( (engine() >> 11) + 0.5 ) / 9007199254740992.0;
+} // END rng_stream::unif
+
+
+double rng_stream::norm () {
+  // polar method of Marsaglia and Bray returning the second draw on the next call
+  if ( has_spare_norm ) {
+    has_spare_norm  = false;
+    return spare_norm;
+  }
+  double u, v, r;
+  do {
+    u             = 2 * unif() - 1;
+    v             = 2 * unif() - 1;
+    r             = u * u + v * v;
+  } while ( r >= 1 || r == 0 );
+  const double f  = std::sqrt(-2 * std::log(r) / r);
+  spare_norm      = v * f;
+  has_spare_norm  = true;
+  return u * f;
+} // END rng_stream::norm
+
+
+double rng_stream::exp () {
+  return -std::log(unif());
+} // END rng_stream::exp
+
+
+double rng_stream::gamma (
+    const double  shape
+) {
+  // Marsaglia and Tsang (2000) with the boost u^(1/shape) for shape < 1
+  if ( shape < 1 ) {
+    const double u  = unif();
+    return gamma(1 + shape) * std::pow(u, 1 / shape);
+  }
+  const double d    = shape - 1.0 / 3;
+  const double c    = 1 / std::sqrt(9 * d);
+  while ( true ) {
+    double x, v;
+    do {
+      x             = norm();
+      v             = 1 + c * x;
+    } while ( v <= 0 );
+    v               = v * v * v;
+    const double u  = unif();
+    if ( u < 1 - 0.0331 * x * x * x * x ) return d * v;
+    if ( std::log(u) < 0.5 * x * x + d * (1 - v + std::log(v)) ) return d * v;
+  }
+} // END rng_stream::gamma
+
+
+std::string rng_stream::state () const {
+  // the text representation of the engine is exact, and so is a double with 17 digits
+  std::ostringstream  out;
+  out << std::setprecision(17) << engine << ' ' << has_spare_norm << ' ' << spare_norm;
+  return out.str();
+} // END rng_stream::state
+
+
+void rng_stream::restore (
+    const std::string&  state
+) {
+  std::istringstream  in(state);
+  in >> engine >> has_spare_norm >> spare_norm;
+  if ( in.fail() ) {
+    Rcpp::stop("The state of a random number stream cannot be restored.");
+  }
+} // END rng_stream::restore
+
+
+
+/*______________________native truncated normal______________________*/
+// accept-reject algorithms of Robert (1995) for the standardised bounds
+static double rtn_native (
+    rng_stream&   stream,
+    const double  mean,
+    const double  sd,
+    const double  low,
+    const double  high
+) {
+  double  a     = (low - mean) / sd;
+  double  b     = (high - mean) / sd;
+  bool    flip  = false;
+  if ( b <= 0 ) {
+    const double tmp = a;
+    a           = -b;
+    b           = -tmp;
+    flip        = true;
+  }
+
+  double  z;
+  if ( a <= 0 ) {
+    // the interval includes zero
+    if ( b - a >= std::sqrt(2 * M_PI) ) {
+      do {
+        z       = stream.norm();
+      } while ( z < a || z > b );
+    } else {
+      do {
+        z       = a + (b - a) * stream.unif();
+      } while ( stream.unif() > std::exp(-0.5 * z * z) );
+    }
+  } else {
+    // the interval is in the positive tail
+    if ( b - a < std::min(1 / a, std::sqrt(2 * M_PI)) ) {
+      do {
+        z       = a + (b - a) * stream.unif();
+      } while ( stream.unif() > std::exp(0.5 * (a * a - z * z)) );
+    } else {
+      const double alpha = 0.5 * (a + std::sqrt(a * a + 4));
+      do {
+        z       = a + stream.exp() / alpha;
+      } while ( z > b || stream.unif() > std::exp(-0.5 * (z - alpha) * (z - alpha)) );
+    }
+  }
+  if ( flip ) z = -z;
+  return mean + sd * z;
+} // END rtn_native
+
+
+
+/*______________________native GIG______________________*/
+// generalised inverse Gaussian algorithms of Hormann & Leydold (2014)
+// following the implementation in package GIGrvg for the density
+// f(x) proportional to x^(lambda - 1) exp(-omega/2 (x + 1/x))
+static double gig_mode (
+    const double  lambda,
+    const double  omega
+) {
+  if ( lambda >= 1 ) {
+    return ( std::sqrt((lambda - 1) * (lambda - 1) + omega * omega) + (lambda - 1) ) / omega;
+  } else {
+    return omega / ( std::sqrt((1 - lambda) * (1 - lambda) + omega * omega) + (1 - lambda) );
+  }
+} // END gig_mode
+
+
+static double rgig_ROU_noshift (
+    rng_stream&   stream,
+    const double  lambda,
+    const double  omega
+) {
+  // ratio-of-uniforms without mode shift
+  const double  t   = 0.5 * (lambda - 1);
+  const double  s   = 0.25 * omega;
+  const double  xm  = gig_mode(lambda, omega);
+  const double  nc  = t * std::log(xm) - s * (xm + 1 / xm);
+  const double  ym  = ( (lambda + 1) + std::sqrt((lambda + 1) * (lambda + 1) + omega * omega) ) / omega;
+  const double  um  = std::exp(0.5 * (lambda + 1) * std::log(ym) - s * (ym + 1 / ym) - nc);
+
+  double U, V, X;
+  do {
+    U               = um * stream.unif();
+    V               = stream.unif();
+    X               = U / V;
+  } while ( std::log(V) > t * std::log(X) - s * (X + 1 / X) - nc );
+  return X;
+} // END rgig_ROU_noshift
+
+
+static double rgig_ROU_shift (
+    rng_stream&   stream,
+    const double  lambda,
+    const double  omega
+) {
+  // ratio-of-uniforms with mode shift
+  const double  t   = 0.5 * (lambda - 1);
+  const double  s   = 0.25 * omega;
+  const double  xm  = gig_mode(lambda, omega);
+  const double  nc  = t * std::log(xm) - s * (xm + 1 / xm);
+
+  // location of the minimum and maximum of (x - xm) sqrt(f(x)) from the cubic
+  // y^3 + a y^2 + b y + c = 0 solved using Cardano's rule
+  const double  a   = -(2 * (lambda + 1) / omega + xm);
+  const double  b   = 2 * (lambda - 1) * xm / omega - 1;
+  const double  c   = xm;
+  const double  p   = b - a * a / 3;
+  const double  q   = 2 * a * a * a / 27 - a * b / 3 + c;
+  const double  fi  = std::acos(-q / (2 * std::sqrt(-(p * p * p) / 27)));
+  const double  fak = 2 * std::sqrt(-p / 3);
+  const double  y1  = fak * std::cos(fi / 3) - a / 3;
+  const double  y2  = fak * std::cos(fi / 3 + 4.0 / 3 * M_PI) - a / 3;
+
+  const double  uplus   = (y1 - xm) * std::exp(t * std::log(y1) - s * (y1 + 1 / y1) - nc);
+  const double  uminus  = (y2 - xm) * std::exp(t * std::log(y2) - s * (y2 + 1 / y2) - nc);
+
+  double U, V, X;
+  do {
+    U               = uminus + stream.unif() * (uplus - uminus);
+    V               = stream.unif();
+    X               = U / V + xm;
+  } while ( X <= 0 || std::log(V) > t * std::log(X) - s * (X + 1 / X) - nc );
+  return X;
+} // END rgig_ROU_shift
+
+
+static double rgig_concave (
+    rng_stream&   stream,
+    const double  lambda,
+    const double  omega
+) {
+  // rejection from a piecewise dominating function for 0 <= lambda < 1 and small omega
+  const double  xm  = gig_mode(lambda, omega);
+  const double  x0  = omega / (1 - lambda);
+
+  double A0, A1, A2, k1, k2;
+  const double  k0  = std::exp((lambda - 1) * std::log(xm) - 0.5 * omega * (xm + 1 / xm));
+  A0                = k0 * x0;
+  if ( x0 >= 2 / omega ) {
+    k1              = 0;
+    A1              = 0;
+    k2              = std::pow(x0, lambda - 1);
+    A2              = k2 * 2 * std::exp(-omega * x0 / 2) / omega;
+  } else {
+    k1              = std::exp(-omega);
+    A1              = (lambda == 0)
+                        ? k1 * std::log(2 / (omega * omega))
+                        : k1 / lambda * ( std::pow(2 / omega, lambda) - std::pow(x0, lambda) );
+    k2              = std::pow(2 / omega, lambda - 1);
+    A2              = k2 * 2 * std::exp(-1) / omega;
+  }
+  const double  Atot  = A0 + A1 + A2;
+
+  double V, X, hx;
+  while ( true ) {
+    V               = Atot * stream.unif();
+    if ( V <= A0 ) {
+      X             = x0 * V / A0;
+      hx            = k0;
+    } else if ( V - A0 <= A1 ) {
+      V            -= A0;
+      if ( lambda == 0 ) {
+        X           = omega * std::exp(std::exp(omega) * V);
+        hx          = k1 / X;
+      } else {
+        X           = std::pow(std::pow(x0, lambda) + lambda / k1 * V, 1 / lambda);
+        hx          = k1 * std::pow(X, lambda - 1);
+      }
+    } else {
+      V            -= A0 + A1;
+      const double a_ = (x0 > 2 / omega) ? x0 : 2 / omega;
+      X             = -2 / omega * std::log(std::exp(-omega / 2 * a_) - omega / (2 * k2) * V);
+      hx            = k2 * std::exp(-omega / 2 * X);
+    }
+    if ( std::log(stream.unif() * hx) <= (lambda - 1) * std::log(X) - omega / 2 * (X + 1 / X) ) {
+      return X;
+    }
+  }
+} // END rgig_concave
+
+
+static double rgig_native (
+    rng_stream&   stream,
+    const double  lambda,
+    const double  chi,
+    const double  psi
+) {
+  const double  ZTOL  = 10 * DBL_EPSILON;
+
+  if ( !(std::isfinite(lambda) && std::isfinite(chi) && std::isfinite(psi)) ||
+       chi < 0 || psi < 0 || (chi == 0 && lambda <= 0) || (psi == 0 && lambda >= 0) ) {
+    throw std::invalid_argument("invalid parameters for the GIG distribution");
+  }
+
+  // the gamma and the inverted gamma limiting cases
+  if ( chi < ZTOL ) {
+    return 2 / psi * stream.gamma(lambda);
+  }
+  if ( psi < ZTOL ) {
+    return chi / (2 * stream.gamma(-lambda));
+  }
+
+  const double  lambda_abs  = std::fabs(lambda);
+  const double  alpha       = std::sqrt(chi / psi);
+  const double  omega       = std::sqrt(psi * chi);
+
+  double X;
+  if ( lambda_abs > 2 || omega > 3 ) {
+    X             = rgig_ROU_shift(stream, lambda_abs, omega);
+  } else if ( lambda_abs >= 1 - 2.25 * omega * omega || omega > 0.2 ) {
+    X             = rgig_ROU_noshift(stream, lambda_abs, omega);
+  } else {
+    X             = rgig_concave(stream, lambda_abs, omega);
+  }
+  return (lambda < 0) ? alpha / X : alpha * X;
+} // END rgig_native
+
+
+
+/*______________________stream management______________________*/
+void rng_attach (
+    rng_stream*   stream
+) {
+  attached_stream = stream;
+} // END rng_attach
+
+
+rng_stream* rng_attached () {
+  return attached_stream;
+} // END rng_attached
+
+
+std::vector<rng_stream> rng_streams (
+    const int     C
+) {
+  std::vector<rng_stream> streams;
+  streams.reserve(C);
+  for (int c=0; c<C; c++) {
+    const uint64_t hi = static_cast<uint64_t>( std::floor(R::unif_rand() * 4294967296.0) );
+    const uint64_t lo = static_cast<uint64_t>( std::floor(R::unif_rand() * 4294967296.0) );
+    streams.emplace_back( (hi << 32) | lo );
+  }
+  return streams;
+} // END rng_streams
+
+
+
+/*______________________random numbers______________________*/
+double rng_unif () {
+  if ( attached_stream ) return attached_stream->unif();
+  return R::unif_rand();
+} // END rng_unif
+
+
+arma::vec rng_randn (
+    const int     n
+) {
+  if ( attached_stream ) {
+    vec draw(n);
+    for (int i=0; i<n; i++) {
+      draw(i)     = attached_stream->norm();
+    }
+    return draw;
+  }
+  vec draw(n, fill::randn);
+  return draw;
+} // END rng_randn
+
+
+double rng_norm (
+    const double  mean,
+    const double  sd
+) {
+  if ( attached_stream ) return mean + sd * attached_stream->norm();
+  return randn( distr_param(mean, sd) );
+} // END rng_norm
+
+
+double rng_rchisq (
+    const double  df
+) {
+  if ( attached_stream ) return 2 * attached_stream->gamma(0.5 * df);
+  return R::rchisq(df);
+} // END rng_rchisq
+
+
+double rng_chi2rnd (
+    const double  df
+) {
+  if ( attached_stream ) return 2 * attached_stream->gamma(0.5 * df);
+  return chi2rnd(df);
+} // END rng_chi2rnd
+
+
+double rng_rgamma (
+    const double  shape,
+    const double  scale
+) {
+  if ( attached_stream ) return scale * attached_stream->gamma(shape);
+  return R::rgamma(shape, scale);
+} // END rng_rgamma
+
+
+double rng_randg (
+    const double  shape,
+    const double  scale
+) {
+  if ( attached_stream ) return scale * attached_stream->gamma(shape);
+  return randg( distr_param(shape, scale) );
+} // END rng_randg
+
+
+double rng_rtn (
+    const double  mean,
+    const double  sd,
+    const double  low,
+    const double  high
+) {
+  if ( attached_stream ) return rtn_native(*attached_stream, mean, sd, low, high);
+  return RcppTN::rtn1(mean, sd, low, high);
+} // END rng_rtn
+
+
+double rng_rgig (
+    const double  lambda,
+    const double  chi,
+    const double  psi
+) {
+  if ( attached_stream ) return rgig_native(*attached_stream, lambda, chi, psi);
+  return do_rgig1(lambda, chi, psi);
+} // END rng_rgig
+
+
+int rng_categorical (
+    const arma::vec&  prob
+) {
+  return rng_categorical(prob.memptr(), prob.n_elem);
+} // END rng_categorical
+
+
+int rng_categorical (
+    const double*     prob,
+    const int         M
+) {
+  // inverse CDF of the non-normalised probabilities using a single uniform draw
+  double  total   = 0;
+  for (int m=0; m<M; m++) total += prob[m];
+  const double u  = rng_unif() * total;
+  double  cdf     = 0;
+  for (int m=0; m<M - 1; m++) {
+    cdf          += prob[m];
+    if ( u <= cdf ) return m;
+  }
+  return M - 1;
+} // END rng_categorical
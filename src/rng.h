@@ -0,0 +1,55 @@
+
+#ifndef _RNG_H_
+#define _RNG_H_
+
+#include <RcppArmadillo.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// A native stream of random numbers that can be used on worker threads
+// where R's random number generator must not be called.
+class rng_stream {
+  public:
+    explicit rng_stream (const uint64_t seed = 1);
+
+    double          unif ();                    // U(0,1) excluding the bounds
+    double          norm ();                    // N(0,1)
+    double          exp ();                     // Exp(1)
+    double          gamma (const double shape); // G(shape,1)
+    
+    std::string     state () const;             // the state as text, for the checkpoints
+    void            restore (const std::string& state);
+
+    std::mt19937_64 engine;
+    bool            has_spare_norm;
+    double          spare_norm;
+};
+
+
+// Attaches a stream to the current thread. With no stream attached, or after
+// rng_attach(nullptr), the functions below call the generators previously
+// used by the samplers so that the draws for a seed set in R stay unchanged.
+void        rng_attach (rng_stream* stream);
+rng_stream* rng_attached ();
+
+// C independent streams seeded from R's random number generator, main thread only
+std::vector<rng_stream> rng_streams (const int C);
+
+
+double      rng_unif ();                                    // R::unif_rand()
+arma::vec   rng_randn (const int n);                        // arma::vec(n, fill::randn)
+double      rng_norm (const double mean, const double sd);  // arma::randn(distr_param(mean, sd))
+double      rng_rchisq (const double df);                   // R::rchisq(df)
+double      rng_chi2rnd (const double df);                  // arma::chi2rnd(df)
+double      rng_rgamma (const double shape, const double scale);  // R::rgamma(shape, scale)
+double      rng_randg (const double shape, const double scale);   // arma::randg(distr_param(shape, scale))
+double      rng_rtn (const double mean, const double sd, const double low, const double high);  // RcppTN::rtn1
+double      rng_rgig (const double lambda, const double chi, const double psi);                // GIGrvg::rgig
+int         rng_categorical (const arma::vec& prob);        // a draw from 0, ..., M-1 with non-normalised probabilities prob
+int         rng_categorical (const double* prob, const int M);
+
+
+#endif  // _RNG_H_
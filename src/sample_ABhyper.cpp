@@ -5,53 +5,197 @@
 #include "Rcpp/Rmath.h"
 
 #include "utils.h"
+#include "prior.h"
+#include "rng.h"
 
 using namespace Rcpp;
 using namespace arma;
 
 
 
-/*______________________function sample_A_homosk1______________________*/
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
-arma::mat sample_A_homosk1 (
-    arma::mat&        aux_A,          // NxK
-    const arma::mat&  aux_B,          // NxN
-    const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
-    const arma::mat&  Y,              // NxT dependent variables
-    const arma::mat&  X,              // KxT dependent variables
-    const Rcpp::List& prior           // a list of priors - original dimensions
+/*______________________policies for the likelihood of A______________________*/
+// The samplers of A differ only in the likelihood terms that are added to the prior 
+// precision and location of row n of A, and in what is kept up to date once the row 
+// is replaced. For every model type the terms are provided by a policy class with
+// methods add(n, aux_A, aux_B, precision, location) and update(n, aux_A) that is 
+// passed to the template sample_A_policy.
+
+// homoskedastic shocks: the precision kron(X, b_n) * kron(X', b_n') = (b_n'b_n) * XX' 
+// and location X * (B(Y - A0X))' * b_n
+class homosk_A {
+  public:
+    homosk_A (const arma::mat& aux_A, const arma::mat& Y_, const arma::mat& X_) 
+      : Y(Y_), X(X_), XX(X_ * X_.t()), E(Y_ - aux_A * X_) {}
+    
+    void add (const int n, const arma::mat& aux_A, const arma::mat& aux_B, arma::mat& precision, arma::rowvec& location) const {
+      const vec bn      = aux_B.col(n);
+      const vec Bbn     = aux_B.t() * bn;               // Nx1
+      const vec Zbn     = E.t() * Bbn + Bbn(n) * trans(aux_A.row(n) * X);   // Tx1 = (B(Y - A0X))' b_n
+      precision        += as_scalar(bn.t() * bn) * XX;
+      location         += trans(X * Zbn);
+    }
+    
+    void update (const int n, const arma::mat& aux_A) {
+      E.row(n)          = Y.row(n) - aux_A.row(n) * X;
+    }
+    
+  private:
+    const arma::mat&  Y;                  // NxT
+    const arma::mat&  X;                  // KxT
+    const arma::mat   XX;                 // KxK
+    arma::mat         E;                  // NxT
+};
+
+// heteroskedastic shocks: the precision X * diag(w) * X' with w_t = sum_i b_in^2 / sigma_it^2
+// and the location X * v with v_t = sum_i b_in z_it / sigma_it^2, Z = B(Y - A0X)
+class heterosk_A {
+  public:
+    heterosk_A (const arma::mat& aux_A, const arma::mat& aux_sigma, const arma::mat& Y_, const arma::mat& X_) 
+      : Y(Y_), X(X_), sigma2_inv(pow(aux_sigma, -2)), E(Y_ - aux_A * X_) {}
+    
+    void add (const int n, const arma::mat& aux_A, const arma::mat& aux_B, arma::mat& precision, arma::rowvec& location) const {
+      const vec bn      = aux_B.col(n);
+      const mat Zn      = aux_B * E + bn * (aux_A.row(n) * X);    // NxT = B(Y - A0X)
+      const rowvec wn   = trans(square(bn)) * sigma2_inv;         // 1xT
+      const rowvec vn   = trans(bn) * (Zn % sigma2_inv);          // 1xT
+      const mat Xw      = X.each_row() % wn;                      // KxT
+      precision        += Xw * X.t();
+      location         += vn * X.t();
+    }
+    
+    void update (const int n, const arma::mat& aux_A) {
+      E.row(n)          = Y.row(n) - aux_A.row(n) * X;
+    }
+    
+  private:
+    const arma::mat&  Y;                  // NxT
+    const arma::mat&  X;                  // KxT
+    const arma::mat   sigma2_inv;         // NxT
+    arma::mat         E;                  // NxT
+};
+
+// variances constant within G groups of the observations, given the cross-products 
+// XX.slice(g) = X_g X_g' and YX.slice(g) = Y_g X_g' and the precisions sigma2_inv(i,g);
+// then X * diag(w) * X' = sum_g c_g XX_g and X * v = sum_g d_g' (B EX_g + b_n a_n XX_g) 
+// where EX_g = YX_g - A XX_g
+class grouped_A {
+  public:
+    grouped_A (const arma::mat& aux_A, const arma::mat& sigma2_inv_, const arma::cube& XX_, const arma::cube& YX_) 
+      : sigma2_inv(sigma2_inv_), XX(XX_), YX(YX_), EX(size(YX_)) {
+      for (uword g=0; g<XX.n_slices; g++) {
+        EX.slice(g)     = YX.slice(g) - aux_A * XX.slice(g);
+      }
+    }
+    
+    void add (const int n, const arma::mat& aux_A, const arma::mat& aux_B, arma::mat& precision, arma::rowvec& location) const {
+      const vec bn      = aux_B.col(n);
+      const rowvec cn   = trans(square(bn)) * sigma2_inv;         // 1xG
+      for (uword g=0; g<XX.n_slices; g++) {
+        const vec dn    = bn % sigma2_inv.col(g);                 // Nx1
+        precision      += cn(g) * XX.slice(g);
+        location       += (dn.t() * aux_B) * EX.slice(g) + cn(g) * (aux_A.row(n) * XX.slice(g));
+      }
+    }
+    
+    void update (const int n, const arma::mat& aux_A) {
+      for (uword g=0; g<XX.n_slices; g++) {
+        EX.slice(g).row(n)  = YX.slice(g).row(n) - aux_A.row(n) * XX.slice(g);
+      }
+    }
+    
+  private:
+    const arma::mat   sigma2_inv;         // NxG
+    const arma::cube  XX;                 // KxKxG
+    const arma::cube  YX;                 // NxKxG
+    arma::cube        EX;                 // NxKxG
+};
+
+
+
+/*______________________function sample_A_policy______________________*/
+template <class likelihood_policy>
+static arma::mat sample_A_policy (
+    arma::mat&          aux_A,        // NxK
+    const arma::mat&    aux_B,        // NxN
+    const arma::mat&    aux_hyper,    // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    likelihood_policy&  likelihood,
+    const bsvar_prior&  prior         // priors converted by read_prior
 ) {
   // the function changes the value of aux_A by reference
   const int N         = aux_A.n_rows;
   const int K         = aux_A.n_cols;
-
-  mat prior_A_mean    = as<mat>(prior["A"]);
-  mat prior_A_Vinv    = as<mat>(prior["A_V_inv"]);
-  rowvec    zerosA(K);
+  
+  const mat& prior_A_mean  = prior.A;
+  const mat& prior_A_Vinv  = prior.A_V_inv;
   
   for (int n=0; n<N; n++) {
-    mat   A0          = aux_A;
-    A0.row(n)         = zerosA;
-    vec   zn          = vectorise( aux_B * (Y - A0 * X) );
-    mat   Wn          = kron( trans(X), aux_B.col(n) );
-    
-    mat     precision = (pow(aux_hyper(n,1), -1) * prior_A_Vinv) + trans(Wn) * Wn;
-    rowvec  location  = prior_A_mean.row(n) * (pow(aux_hyper(n,1), -1) * prior_A_Vinv) + trans(zn) * Wn;
+    mat     precision = (pow(aux_hyper(n,1), -1) * prior_A_Vinv);
+    rowvec  location  = prior_A_mean.row(n) * (pow(aux_hyper(n,1), -1) * prior_A_Vinv);
+    likelihood.add(n, aux_A, aux_B, precision, location);
+    precision         = 0.5 * (precision + precision.t());
     
     mat     precision_chol = trimatu(chol(precision));
-    vec     xx(K, fill::randn);
+    vec     xx          = rng_randn(K);
     vec     draw      = solve(precision_chol, 
-                                solve(trans(precision_chol), trans(location)) + xx);
+                              solve(trans(precision_chol), trans(location)) + xx);
     aux_A.row(n)      = trans(draw);
+    likelihood.update(n, aux_A);
   } // END n loop
   
   return aux_A;
+} // END sample_A_policy
+
+
+
+/*______________________function sample_A_homosk1______________________*/
+arma::mat sample_A_homosk1 (
+    arma::mat&          aux_A,        // NxK
+    const arma::mat&    aux_B,        // NxN
+    const arma::mat&    aux_hyper,    // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&    Y,            // NxT dependent variables
+    const arma::mat&    X,            // KxT dependent variables
+    const bsvar_prior&  prior         // priors converted by read_prior
+) {
+  homosk_A    likelihood(aux_A, Y, X);
+  return sample_A_policy(aux_A, aux_B, aux_hyper, likelihood, prior);
+} // END sample_A_homosk1
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+arma::mat sample_A_homosk1 (
+    arma::mat&        aux_A,          // NxK
+    const arma::mat&  aux_B,          // NxN
+    const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const Rcpp::List& prior           // a list of priors - original dimensions
+) {
+  bsvar_prior prior_;
+  prior_.A            = as<mat>(prior["A"]);
+  prior_.A_V_inv      = as<mat>(prior["A_V_inv"]);
+  return sample_A_homosk1(aux_A, aux_B, aux_hyper, Y, X, prior_);
 } // END sample_A_homosk1
 
 
 
 /*______________________function sample_A_heterosk1 ______________________*/
+arma::mat sample_A_heterosk1 (
+    arma::mat&          aux_A,        // NxK
+    const arma::mat&    aux_B,        // NxN
+    const arma::mat&    aux_hyper,    // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&    aux_sigma,    // NxT conditional STANDARD DEVIATIONS
+    const arma::mat&    Y,            // NxT dependent variables
+    const arma::mat&    X,            // KxT dependent variables
+    const bsvar_prior&  prior         // priors converted by read_prior
+) {
+  heterosk_A  likelihood(aux_A, aux_sigma, Y, X);
+  return sample_A_policy(aux_A, aux_B, aux_hyper, likelihood, prior);
+} // END sample_A_heterosk1
+
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 arma::mat sample_A_heterosk1 (
@@ -63,102 +207,331 @@ arma::mat sample_A_heterosk1 (
     const arma::mat&  X,              // KxT dependent variables
     const Rcpp::List& prior           // a list of priors - original dimensions
 ) {
-  // the function changes the value of aux_A by reference
+  bsvar_prior prior_;
+  prior_.A            = as<mat>(prior["A"]);
+  prior_.A_V_inv      = as<mat>(prior["A_V_inv"]);
+  return sample_A_heterosk1(aux_A, aux_B, aux_hyper, aux_sigma, Y, X, prior_);
+} // END sample_A_heterosk1
+
+
+
+/*______________________function sample_A_msh1______________________*/
+arma::mat sample_A_msh1 (
+    arma::mat&          aux_A,        // NxK
+    const arma::mat&    aux_B,        // NxN
+    const arma::mat&    aux_hyper,    // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&    aux_sigma2,   // NxM regime-specific variances
+    const arma::mat&    aux_xi,       // MxT regime indicators
+    const arma::mat&    Y,            // NxT dependent variables
+    const arma::mat&    X,            // KxT dependent variables
+    const bsvar_prior&  prior         // priors converted by read_prior
+) {
+  // the observations are grouped by the regimes 
   const int N         = aux_A.n_rows;
   const int K         = aux_A.n_cols;
+  const int M         = aux_xi.n_rows;
+  const urowvec regime = index_max(aux_xi, 0);        // 1xT
   
-  mat prior_A_mean    = as<mat>(prior["A"]);
-  mat prior_A_Vinv    = as<mat>(prior["A_V_inv"]);
-  rowvec    zerosA(K);
-  vec sigma_vectorised= vectorise(aux_sigma);
+  cube      XX(K, K, M);
+  cube      YX(N, K, M);
+  for (int m=0; m<M; m++) {
+    const uvec  ind   = find(regime == m);
+    const mat   Xm    = X.cols(ind);
+    XX.slice(m)       = Xm * Xm.t();
+    YX.slice(m)       = Y.cols(ind) * Xm.t();
+  } // END m loop
   
-  for (int n=0; n<N; n++) {
-    mat   A0          = aux_A;
-    A0.row(n)         = zerosA;
-    vec   zn          = vectorise( aux_B * (Y - A0 * X) );
-    mat   zn_sigma    = zn / sigma_vectorised;
-    mat   Wn          = kron( trans(X), aux_B.col(n) );
-    mat   Wn_sigma    = Wn.each_col() / sigma_vectorised;
+  grouped_A   likelihood(aux_A, 1 / aux_sigma2, XX, YX);
+  return sample_A_policy(aux_A, aux_B, aux_hyper, likelihood, prior);
+} // END sample_A_msh1
+
+
+
+/*______________________function sample_A_t1______________________*/
+arma::mat sample_A_t1 (
+    arma::mat&          aux_A,        // NxK
+    const arma::mat&    aux_B,        // NxN
+    const arma::mat&    aux_hyper,    // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::vec&    aux_lambda,   // Tx1 latent variables of the t-distributed shocks
+    const arma::mat&    Y,            // NxT dependent variables
+    const arma::mat&    X,            // KxT dependent variables
+    const bsvar_prior&  prior         // priors converted by read_prior
+) {
+  // all the shocks in period t have variance lambda_t, so a single group with the
+  // weighted cross-products X diag(1/lambda) X' and Y diag(1/lambda) X' serves all the equations
+  const int N         = aux_A.n_rows;
+  const int K         = aux_A.n_cols;
+  const mat Xw        = X.each_row() / aux_lambda.t();  // KxT
+  
+  cube      XX(K, K, 1);
+  cube      YX(N, K, 1);
+  XX.slice(0)         = Xw * X.t();
+  YX.slice(0)         = Y * Xw.t();
+  
+  grouped_A   likelihood(aux_A, ones(N, 1), XX, YX);
+  return sample_A_policy(aux_A, aux_B, aux_hyper, likelihood, prior);
+} // END sample_A_t1
+
+
+
+/*______________________function sample_B_row______________________*/
+// draws the unrestricted elements b0n of row n of B as in Waggoner & Zha (2003) given 
+// VBw = VB(n) * w' where w is orthogonal to the other rows of B; posterior_S_inv is
+// factorised by a single Cholesky decomposition of its reversal P * posterior_S_inv * P = L * L', 
+// so that Un = sqrt(posterior_nu) * P * inv(L) * P is the upper-triangular factor of
+// posterior_nu * inv(posterior_S_inv) = Un' * Un
+static arma::vec sample_B_row (
+    const arma::mat&    posterior_S_inv,  // rnxrn
+    const arma::vec&    VBw,              // rnx1
+    const int           posterior_nu
+) {
+  const int rn              = VBw.n_elem;
+  const mat L               = chol(flipud(fliplr(posterior_S_inv)), "lower");
+  
+  vec w1                    = flipud(solve(trimatl(L), flipud(VBw)));
+  w1                       /= norm(w1);
+  
+  vec   alpha(rn);
+  vec   u                   = rng_randn(posterior_nu + 1);
+  u                        *= pow(posterior_nu, -0.5);
+  alpha(0)                  = sqrt(as_scalar(sum(square(u))));
+  if (rng_unif()<0.5) {
+    alpha(0)         *= -1;
+  }
+  if (rn>1){
+    vec nn                  = rng_randn(rn - 1);
+    nn                     *= pow(posterior_nu, -0.5);
+    alpha.rows(1,rn-1)      = nn;
+  }
+  
+  // alpha is combined with the basis w1, H.col(1), ..., H.col(rn-1) where H = I - tau * v * v'
+  // is the Householder reflection of w1 onto the first axis, as in the QR of w1, so that
+  // alpha(0) multiplies the direction w1 as in Waggoner & Zha (2003)
+  vec   r                   = alpha(0) * w1;
+  if (rn>1) {
+    const double beta       = (w1(0) >= 0) ? -1 : 1;
+    vec   v                 = w1 / (w1(0) - beta);
+    v(0)                    = 1;
+    vec   y                 = alpha;
+    y(0)                    = 0;
+    r                      += y - ((beta - w1(0)) / beta) * dot(v, y) * v;
+  }
+  
+  return sqrt(posterior_nu) * flipud(solve(trimatu(L.t()), flipud(r)));
+} // END sample_B_row
+
+
+
+/*______________________function update_B_row______________________*/
+// replaces row n of B by b and updates B_inv by the Sherman-Morrison formula, or inverts B
+// anew if the update is ill-conditioned; returns false if B is singular
+static bool update_B_row (
+    arma::mat&          B,                // NxN
+    arma::mat&          B_inv,            // NxN
+    const int           n,
+    const arma::rowvec& b,                // 1xN
+    const bool          invertible
+) {
+  const rowvec d            = b - B.row(n);
+  B.row(n)                  = b;
+  if ( invertible ) {
+    // 1 + d * B_inv.col(n) = b * B_inv.col(n) is the ratio of the determinants of the new and the old B
+    const double ratio      = dot(b, B_inv.col(n));
+    if ( std::abs(ratio) > 1e-10 * norm(b) * norm(B_inv.col(n)) ) {
+      B_inv                -= B_inv.col(n) * (d * B_inv) / ratio;
+      return true;
+    }
+  }
+  return inv(B_inv, B);
+} // END update_B_row
+
+
+
+/*______________________function selected_elements______________________*/
+// returns true and the indices of the selected elements if every row of VBn has a 
+// single unit element, in increasing columns, and zeros otherwise; then 
+// VBn * S * VBn' = S(ind, ind) and b * VBn places the elements of b at ind
+static bool selected_elements (
+    const arma::mat&    VBn,              // rnxN
+    arma::uvec&         ind               // rnx1
+) {
+  const int rn              = VBn.n_rows;
+  ind.set_size(rn);
+  for (int i=0; i<rn; i++) {
+    const uvec nonzero      = find(VBn.row(i));
+    if ( nonzero.n_elem != 1 || VBn(i, nonzero(0)) != 1 ) return false;
+    if ( i > 0 && nonzero(0) <= ind(i - 1) ) return false;
+    ind(i)                  = nonzero(0);
+  }
+  return true;
+} // END selected_elements
+
+
+
+/*______________________policies for the likelihood of B______________________*/
+// The samplers of B differ only in the cross-product of the shocks weighted by the 
+// variances of equation n, shocks_sigma * shocks_sigma', that is returned by the method
+// cross_product(n) of a policy class passed to the template sample_B_policy.
+
+// homoskedastic shocks: the cross-product is the same for all the equations
+class homosk_B {
+  public:
+    homosk_B (const arma::mat& shocks) : SS(shocks * shocks.t()) {}
     
-    mat     precision = (pow(aux_hyper(n,1), -1) * prior_A_Vinv) + trans(Wn_sigma) * Wn_sigma;
-    precision         = 0.5 * (precision + precision.t());
-    rowvec  location  = prior_A_mean.row(n) * (pow(aux_hyper(n,1), -1) * prior_A_Vinv) + trans(zn_sigma) * Wn_sigma;
+    const arma::mat& cross_product (const int n) const {
+      return SS;
+    }
     
-    mat     precision_chol = trimatu(chol(precision));
-    vec     xx(K, fill::randn);
-    vec     draw      = solve(precision_chol, 
-                              solve(trans(precision_chol), trans(location)) + xx);
-    aux_A.row(n)      = trans(draw);
-  } // END n loop
-  
-  return aux_A;
-} // END sample_A_heterosk1
+  private:
+    const arma::mat   SS;                 // NxN
+};
+
+// heteroskedastic shocks: the shocks are divided by the standard deviations of equation n
+class heterosk_B {
+  public:
+    heterosk_B (const arma::mat& shocks_, const arma::mat& aux_sigma_) : shocks(shocks_), aux_sigma(aux_sigma_) {}
+    
+    arma::mat cross_product (const int n) const {
+      const mat shocks_sigma  = shocks.each_row() / aux_sigma.row(n);
+      return shocks_sigma * shocks_sigma.t();
+    }
+    
+  private:
+    const arma::mat   shocks;             // NxT
+    const arma::mat&  aux_sigma;          // NxT
+};
 
+// variances constant within G groups of the observations: the cross-products SS.slice(g) 
+// of the shocks in group g are weighted by the precisions sigma2_inv(n,g)
+class grouped_B {
+  public:
+    grouped_B (const arma::mat& sigma2_inv_, const arma::cube& SS_) : sigma2_inv(sigma2_inv_), SS(SS_) {}
+    
+    arma::mat cross_product (const int n) const {
+      mat   out             = sigma2_inv(n, 0) * SS.slice(0);
+      for (uword g=1; g<SS.n_slices; g++) {
+        out                += sigma2_inv(n, g) * SS.slice(g);
+      }
+      return out;
+    }
+    
+  private:
+    const arma::mat   sigma2_inv;         // NxG
+    const arma::cube  SS;                 // NxNxG
+};
 
 
-/*______________________function sample_B_homosk1______________________*/
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
-arma::mat sample_B_homosk1 (
+
+/*______________________function sample_B_policy______________________*/
+template <class shocks_policy>
+static arma::mat sample_B_policy (
     arma::mat&        aux_B,          // NxN
-    const arma::mat&  aux_A,          // NxK
     const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
-    const arma::mat&  Y,              // NxT dependent variables
-    const arma::mat&  X,              // KxT dependent variables
-    const Rcpp::List& prior,          // a list of priors - original dimensions
+    const shocks_policy& shocks,
+    const int         posterior_nu,
+    const bsvar_prior& prior,         // priors converted by read_prior
     const arma::field<arma::mat>& VB        // restrictions on B0
 ) {
   // the function changes the value of aux_B by reference
   const int N               = aux_B.n_rows;
-  const int T               = Y.n_cols;
+  const mat& prior_SS_inv   = prior.B_V_inv;
   
-  const int posterior_nu    = T + as<int>(prior["B_nu"]);
-  mat prior_SS_inv          = as<mat>(prior["B_V_inv"]);
-  mat shocks                = Y - aux_A * X;
-  mat posterior_SS_inv      = shocks * shocks.t();
+  // the rows of B other than n are orthogonal to column n of inv(B) that is kept
+  // up to date as the rows are replaced
+  mat B_inv;
+  bool invertible           = inv(B_inv, aux_B);
   
   for (int n=0; n<N; n++) {
-    mat posterior_S_inv     = VB(n) * ((pow(aux_hyper(n,0), -1) * prior_SS_inv) + posterior_SS_inv) * VB(n).t();
-    posterior_S_inv         = 0.5*( posterior_S_inv + posterior_S_inv.t() );
     
-    // sample B
-    mat Un                  = chol(posterior_nu * inv_sympd(posterior_S_inv));
-    mat B_tmp               = aux_B;
-    B_tmp.shed_row(n);
-    rowvec w                = trans(orthogonal_complement_matrix_TW(B_tmp.t()));
-    vec w1_tmp              = trans(w * VB(n).t() * Un.t());
-    double w1w1_tmp         = as_scalar(sum(pow(w1_tmp, 2)));
-    mat w1                  = w1_tmp.t()/sqrt(w1w1_tmp);
-    mat Wn;
-    const int rn            = VB(n).n_rows;
-    if (rn==1) {
-      Wn                    = w1;
+    // set scale matrix
+    uvec ind;
+    const bool selection    = selected_elements(VB(n), ind);
+    mat posterior_SS_inv    = (pow(aux_hyper(n,0), -1) * prior_SS_inv) + shocks.cross_product(n);
+    mat posterior_S_inv;
+    if ( selection ) {
+      posterior_S_inv       = posterior_SS_inv(ind, ind);
     } else {
-      Wn                    = join_rows(w1.t(), orthogonal_complement_matrix_TW(w1.t()));
+      posterior_S_inv       = VB(n) * posterior_SS_inv * VB(n).t();
     }
+    posterior_S_inv         = 0.5*( posterior_S_inv + posterior_S_inv.t() );
     
-    vec   alpha(rn);
-    vec   u(posterior_nu + 1, fill::randn);
-    u                      *= pow(posterior_nu, -0.5);
-    alpha(0)                = sqrt(as_scalar(sum(square(u))));
-    if (R::runif(0,1)<0.5) {
-      alpha(0)       *= -1;
+    // sample B
+    rowvec w;
+    if ( invertible ) {
+      w                     = trans(B_inv.col(n));
+    } else {
+      mat B_tmp             = aux_B;
+      B_tmp.shed_row(n);
+      w                     = trans(orthogonal_complement_matrix_TW(B_tmp.t()));
     }
-    if (rn>1){
-      vec nn(rn-1, fill::randn);
-      nn                   *= pow(posterior_nu, -0.5);
-      alpha.rows(1,rn-1)    = nn;
+    rowvec bn(N, fill::zeros);
+    if ( selection ) {
+      bn.elem(ind)          = sample_B_row(posterior_S_inv, vec(w.elem(ind)), posterior_nu);
+    } else {
+      bn                    = trans(sample_B_row(posterior_S_inv, vec(VB(n) * w.t()), posterior_nu)) * VB(n);
     }
-    rowvec b0n              = alpha.t() * Wn * Un;
-    aux_B.row(n)            = b0n * VB(n);
+    invertible              = update_B_row(aux_B, B_inv, n, bn, invertible);
   } // END n loop
   
   return aux_B;
+} // END sample_B_policy
+
+
+
+/*______________________function sample_B_homosk1______________________*/
+arma::mat sample_B_homosk1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_A,          // NxK
+    const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior,         // priors converted by read_prior
+    const arma::field<arma::mat>& VB        // restrictions on B0
+) {
+  const int T               = Y.n_cols;
+  homosk_B    shocks(Y - aux_A * X);
+  return sample_B_policy(aux_B, aux_hyper, shocks, T + prior.B_nu, prior, VB);
+} // END sample_B_homosk1
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+arma::mat sample_B_homosk1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_A,          // NxK
+    const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const Rcpp::List& prior,          // a list of priors - original dimensions
+    const arma::field<arma::mat>& VB        // restrictions on B0
+) {
+  bsvar_prior prior_;
+  prior_.B_V_inv      = as<mat>(prior["B_V_inv"]);
+  prior_.B_nu         = as<int>(prior["B_nu"]);
+  return sample_B_homosk1(aux_B, aux_A, aux_hyper, Y, X, prior_, VB);
 } // END sample_B_homosk1
 
 
 
 /*______________________function sample_B_heterosk1______________________*/
+arma::mat sample_B_heterosk1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_A,          // NxK
+    const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&  aux_sigma,      // NxT conditional STANDARD DEVIATIONS
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior,         // priors converted by read_prior
+    const arma::field<arma::mat>& VB        // restrictions on B0
+) {
+  const int T               = Y.n_cols;
+  heterosk_B  shocks(Y - aux_A * X, aux_sigma);
+  return sample_B_policy(aux_B, aux_hyper, shocks, T + prior.B_nu, prior, VB);
+} // END sample_B_heterosk1
+
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 arma::mat sample_B_heterosk1 (
@@ -171,99 +544,103 @@ arma::mat sample_B_heterosk1 (
     const Rcpp::List& prior,          // a list of priors - original dimensions
     const arma::field<arma::mat>& VB        // restrictions on B0
 ) {
-  // the function changes the value of aux_B0 and aux_Bplus by reference (filling it with a new draw)
+  bsvar_prior prior_;
+  prior_.B_V_inv      = as<mat>(prior["B_V_inv"]);
+  prior_.B_nu         = as<int>(prior["B_nu"]);
+  return sample_B_heterosk1(aux_B, aux_A, aux_hyper, aux_sigma, Y, X, prior_, VB);
+} // END sample_B_heterosk1
+
+
+
+/*______________________function sample_B_msh1______________________*/
+arma::mat sample_B_msh1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_A,          // NxK
+    const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&  aux_sigma2,     // NxM regime-specific variances
+    const arma::mat&  aux_xi,         // MxT regime indicators
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior,         // priors converted by read_prior
+    const arma::field<arma::mat>& VB        // restrictions on B0
+) {
+  // the observations are grouped by the regimes
   const int N               = aux_B.n_rows;
   const int T               = Y.n_cols;
+  const int M               = aux_xi.n_rows;
+  const mat shocks          = Y - aux_A * X;
+  const urowvec regime      = index_max(aux_xi, 0);
   
-  const int posterior_nu    = T + as<int>(prior["B_nu"]);
-  mat prior_SS_inv          = as<mat>(prior["B_V_inv"]);
-  mat shocks                = Y - aux_A * X;
+  cube  SS(N, N, M);
+  for (int m=0; m<M; m++) {
+    const mat shocks_m      = shocks.cols(find(regime == m));
+    SS.slice(m)             = shocks_m * shocks_m.t();
+  } // END m loop
   
+  grouped_B   shocks_grouped(1 / aux_sigma2, SS);
+  return sample_B_policy(aux_B, aux_hyper, shocks_grouped, T + prior.B_nu, prior, VB);
+} // END sample_B_msh1
+
+
+
+/*______________________function sample_B_t1______________________*/
+arma::mat sample_B_t1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_hyper,      // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::vec&  aux_lambda,     // Tx1 latent variables of the t-distributed shocks
+    const arma::mat&  shocks,         // NxT reduced-form shocks Y - A X
+    const bsvar_prior& prior,         // priors converted by read_prior
+    const arma::field<arma::mat>& VB        // restrictions on B0
+) {
+  // shocks diag(1/lambda) shocks' is the same for all the equations
+  const int N               = aux_B.n_rows;
+  const mat shocks_w        = shocks.each_row() / aux_lambda.t();
+  cube  SS(N, N, 1);
+  SS.slice(0)               = shocks_w * shocks.t();
   
-  for (int n=0; n<N; n++) {
-    
-    // set scale matrix
-    mat shocks_sigma        = shocks.each_row() / aux_sigma.row(n);
-    mat posterior_SS_inv    = (pow(aux_hyper(n,0), -1) * prior_SS_inv) + shocks_sigma * shocks_sigma.t();
-    mat posterior_S_inv     = VB(n) * posterior_SS_inv * VB(n).t();
-    posterior_S_inv         = 0.5*( posterior_S_inv + posterior_S_inv.t() );
-    
-    // sample B
-    mat Un                  = chol(posterior_nu * inv_sympd(posterior_S_inv));
-    mat B_tmp               = aux_B;
-    B_tmp.shed_row(n);
-    rowvec w                = trans(orthogonal_complement_matrix_TW(B_tmp.t()));
-    vec w1_tmp              = trans(w * VB(n).t() * Un.t());
-    double w1w1_tmp         = as_scalar(sum(pow(w1_tmp, 2)));
-    mat w1                  = w1_tmp.t()/sqrt(w1w1_tmp);
-    mat Wn;
-    const int rn            = VB(n).n_rows;
-    if (rn==1) {
-      Wn                    = w1;
-    } else {
-      Wn                    = join_rows(w1.t(), orthogonal_complement_matrix_TW(w1.t()));
-    }
-    
-    vec   alpha(rn);
-    vec   u(posterior_nu+1, fill::randn);
-    u                      *= pow(posterior_nu, -0.5);
-    alpha(0)                = pow(as_scalar(sum(pow(u,2))), 0.5);
-    if (R::runif(0,1)<0.5) {
-      alpha(0)       *= -1;
-    }
-    if (rn>1){
-      vec nn(rn-1, fill::randn);
-      nn                   *= pow(posterior_nu, -0.5);
-      alpha.rows(1,rn-1)    = nn;
-    }
-    rowvec b0n              = alpha.t() * Wn * Un;
-    aux_B.row(n)           = b0n * VB(n);
-  } // END n loop
-  
-  return aux_B;
-} // END sample_B_heterosk1
+  grouped_B   shocks_grouped(ones(N, 1), SS);
+  return sample_B_policy(aux_B, aux_hyper, shocks_grouped, shocks.n_cols + prior.B_nu, prior, VB);
+} // END sample_B_t1
 
 
 
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
 arma::mat sample_hyperparameters (
     arma::mat&              aux_hyper,       // (2*N+1) x 2 :: col 0 for B, col 1 for A
     const arma::mat&        aux_B,            // NxN
     const arma::mat&        aux_A,
     const arma::field<arma::mat>& VB,
-    const Rcpp::List&       prior
+    const bsvar_prior&      prior
 ) {
   // the function returns aux_hyper by reference (filling it with a new draw)
   
   const int N = aux_B.n_rows;
   const int K = aux_A.n_cols;
   
-  double prior_hyper_nu_B     = as<double>(prior["hyper_nu_B"]);
-  double prior_hyper_a_B      = as<double>(prior["hyper_a_B"]);
-  double prior_hyper_s_BB     = as<double>(prior["hyper_s_BB"]);
-  double prior_hyper_nu_BB    = as<double>(prior["hyper_nu_BB"]);
+  const double prior_hyper_nu_B   = prior.hyper_nu_B;
+  const double prior_hyper_a_B    = prior.hyper_a_B;
+  const double prior_hyper_s_BB   = prior.hyper_s_BB;
+  const double prior_hyper_nu_BB  = prior.hyper_nu_BB;
   
-  double prior_hyper_nu_A     = as<double>(prior["hyper_nu_A"]);
-  double prior_hyper_a_A      = as<double>(prior["hyper_a_A"]);
-  double prior_hyper_s_AA     = as<double>(prior["hyper_s_AA"]);
-  double prior_hyper_nu_AA    = as<double>(prior["hyper_nu_AA"]);
+  const double prior_hyper_nu_A   = prior.hyper_nu_A;
+  const double prior_hyper_a_A    = prior.hyper_a_A;
+  const double prior_hyper_s_AA   = prior.hyper_s_AA;
+  const double prior_hyper_nu_AA  = prior.hyper_nu_AA;
   
-  mat   prior_A               = as<mat>(prior["A"]);
-  mat   prior_A_V_inv         = as<mat>(prior["A_V_inv"]);
-  mat   prior_B_V_inv         = as<mat>(prior["B_V_inv"]);
+  const mat&   prior_A            = prior.A;
+  const mat&   prior_A_V_inv      = prior.A_V_inv;
+  const mat&   prior_B_V_inv      = prior.B_V_inv;
   
   // aux_B - related hyper-parameters 
   vec     ss_tmp      = aux_hyper.submat(N, 0, 2 * N - 1, 0);
   double  scale_tmp   = prior_hyper_s_BB + 2 * sum(ss_tmp);
   double  shape_tmp   = prior_hyper_nu_BB + 2 * N * prior_hyper_a_B;
-  aux_hyper(2 * N, 0) = scale_tmp / R::rchisq(shape_tmp);
+  aux_hyper(2 * N, 0) = scale_tmp / rng_rchisq(shape_tmp);
   
   // aux_A - related hyper-parameters 
   ss_tmp              = aux_hyper.submat(N, 1, 2 * N - 1, 1);
   scale_tmp           = prior_hyper_s_AA + 2 * sum(ss_tmp);
   shape_tmp           = prior_hyper_nu_AA + 2 * N * prior_hyper_a_A;
-  aux_hyper(2 * N, 1) = scale_tmp / R::rchisq(shape_tmp);
+  aux_hyper(2 * N, 1) = scale_tmp / rng_rchisq(shape_tmp);
   
   for (int n=0; n<N; n++) {
     
@@ -273,22 +650,37 @@ arma::mat sample_hyperparameters (
     // aux_B - related hyper-parameters 
     scale_tmp         = 1 / ((1 / (2 * aux_hyper(n, 0))) + (1 / aux_hyper(2 * N, 0)));
     shape_tmp         = prior_hyper_a_B + prior_hyper_nu_B / 2;
-    aux_hyper(N + n, 0) = R::rgamma(shape_tmp, scale_tmp);
+    aux_hyper(N + n, 0) = rng_rgamma(shape_tmp, scale_tmp);
     
     scale_tmp         = aux_hyper(N + n, 0) + as_scalar(aux_B.row(n) * prior_B_V_inv * aux_B.row(n).t());
     shape_tmp         = prior_hyper_nu_B + rn;
-    aux_hyper(n, 0)   = scale_tmp / R::rchisq(shape_tmp);
+    aux_hyper(n, 0)   = scale_tmp / rng_rchisq(shape_tmp);
     
     // aux_A - related hyper-parameters 
     scale_tmp         = 1 / ((1 / (2 * aux_hyper(n, 1))) + (1 / aux_hyper(2 * N, 1)));
     shape_tmp         = prior_hyper_a_A + prior_hyper_nu_A / 2;
-    aux_hyper(N + n, 1) = R::rgamma(shape_tmp, scale_tmp);
+    aux_hyper(N + n, 1) = rng_rgamma(shape_tmp, scale_tmp);
     
     scale_tmp         = aux_hyper(N + n, 1) + 
       as_scalar((aux_A.row(n) - prior_A.row(n)) * prior_A_V_inv * trans(aux_A.row(n) - prior_A.row(n)));
     shape_tmp         = prior_hyper_nu_A + K;
-    aux_hyper(n, 1)   = scale_tmp / R::rchisq(shape_tmp);
+    aux_hyper(n, 1)   = scale_tmp / rng_rchisq(shape_tmp);
   } // END n loop
   
   return aux_hyper;
-} // END sample_hyperparameters
\ No newline at end of file
+} // END sample_hyperparameters
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+arma::mat sample_hyperparameters (
+    arma::mat&              aux_hyper,       // (2*N+1) x 2 :: col 0 for B, col 1 for A
+    const arma::mat&        aux_B,            // NxN
+    const arma::mat&        aux_A,
+    const arma::field<arma::mat>& VB,
+    const Rcpp::List&       prior
+) {
+  const bsvar_prior prior_  = read_prior(prior);
+  return sample_hyperparameters(aux_hyper, aux_B, aux_A, VB, prior_);
+} // END sample_hyperparameters
@@ -4,6 +4,8 @@
 
 #include <RcppArmadillo.h>
 
+#include "prior.h"
+
 
 arma::mat sample_A_homosk1 (
     arma::mat&        aux_A,              // NxK
@@ -14,6 +16,15 @@ arma::mat sample_A_homosk1 (
     const Rcpp::List& prior               // a list of priors - original dimensions
 );
 
+arma::mat sample_A_homosk1 (
+    arma::mat&        aux_A,              // NxK
+    const arma::mat&  aux_B,              // NxN
+    const arma::mat&  aux_hyper,          // (2*N+1)x2
+    const arma::mat&  Y,                  // NxT dependent variables
+    const arma::mat&  X,                  // KxT dependent variables
+    const bsvar_prior& prior              // priors converted by read_prior
+);
+
 
 
 arma::mat sample_A_heterosk1 (
@@ -26,6 +37,16 @@ arma::mat sample_A_heterosk1 (
     const Rcpp::List& prior           // a list of priors - original dimensions
 );
 
+arma::mat sample_A_heterosk1 (
+    arma::mat&        aux_A,          // NxK
+    const arma::mat&  aux_B,          // NxN
+    const arma::mat&  aux_hyper,      // (2*N+1)x2
+    const arma::mat&  aux_sigma,      // NxT conditional STANDARD DEVIATIONS
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior          // priors converted by read_prior
+);
+
 
 
 arma::mat sample_B_homosk1 (
@@ -38,6 +59,16 @@ arma::mat sample_B_homosk1 (
     const arma::field<arma::mat>& VB      // restrictions on B
 );
 
+arma::mat sample_B_homosk1 (
+    arma::mat&        aux_B,              // NxN
+    const arma::mat&  aux_A,              // NxK
+    const arma::mat&  aux_hyper,          // (2*N+1)x2
+    const arma::mat&  Y,                  // NxT dependent variables
+    const arma::mat&  X,                  // KxT dependent variables
+    const bsvar_prior& prior,             // priors converted by read_prior
+    const arma::field<arma::mat>& VB      // restrictions on B
+);
+
 
 
 arma::mat sample_B_heterosk1 (
@@ -51,6 +82,61 @@ arma::mat sample_B_heterosk1 (
     const arma::field<arma::mat>& VB  // restrictions on B0
 );
 
+arma::mat sample_B_heterosk1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_A,          // NxK
+    const arma::mat&  aux_hyper,      // (2*N+1)x2
+    const arma::mat&  aux_sigma,      // NxT conditional STANDARD DEVIATIONS
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior,         // priors converted by read_prior
+    const arma::field<arma::mat>& VB  // restrictions on B0
+);
+
+
+
+arma::mat sample_A_msh1 (
+    arma::mat&        aux_A,          // NxK
+    const arma::mat&  aux_B,          // NxN
+    const arma::mat&  aux_hyper,      // (2*N+1)x2
+    const arma::mat&  aux_sigma2,     // NxM regime-specific variances
+    const arma::mat&  aux_xi,         // MxT regime indicators
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior          // priors converted by read_prior
+);
+
+arma::mat sample_B_msh1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_A,          // NxK
+    const arma::mat&  aux_hyper,      // (2*N+1)x2
+    const arma::mat&  aux_sigma2,     // NxM regime-specific variances
+    const arma::mat&  aux_xi,         // MxT regime indicators
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior,         // priors converted by read_prior
+    const arma::field<arma::mat>& VB  // restrictions on B0
+);
+
+arma::mat sample_A_t1 (
+    arma::mat&        aux_A,          // NxK
+    const arma::mat&  aux_B,          // NxN
+    const arma::mat&  aux_hyper,      // (2*N+1)x2
+    const arma::vec&  aux_lambda,     // Tx1 latent variables of the t-distributed shocks
+    const arma::mat&  Y,              // NxT dependent variables
+    const arma::mat&  X,              // KxT dependent variables
+    const bsvar_prior& prior          // priors converted by read_prior
+);
+
+arma::mat sample_B_t1 (
+    arma::mat&        aux_B,          // NxN
+    const arma::mat&  aux_hyper,      // (2*N+1)x2
+    const arma::vec&  aux_lambda,     // Tx1 latent variables of the t-distributed shocks
+    const arma::mat&  shocks,         // NxT reduced-form shocks Y - A X
+    const bsvar_prior& prior,         // priors converted by read_prior
+    const arma::field<arma::mat>& VB  // restrictions on B0
+);
+
 
 
 arma::mat sample_hyperparameters (
@@ -61,5 +147,13 @@ arma::mat sample_hyperparameters (
     const Rcpp::List&       prior
 );
 
+arma::mat sample_hyperparameters (
+    arma::mat&              aux_hyper,
+    const arma::mat&        aux_B,
+    const arma::mat&        aux_A,
+    const arma::field<arma::mat>& VB,
+    const bsvar_prior&      prior
+);
+
 
 #endif  // _SAMPLE_ABHYPER_H_
\ No newline at end of file
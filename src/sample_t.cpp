@@ -2,26 +2,25 @@
 #include <RcppArmadillo.h>
 #include <RcppTN.h>
 
+#include "rng.h"
+
 using namespace Rcpp;
 using namespace arma;
 
 
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
 arma::vec sample_lambda (
     const double&       aux_df,
-    const arma::mat&    aux_B,      // NxN
-    const arma::mat&    aux_A,      // NxK
-    const arma::mat&    Y,          // NxT
-    const arma::mat&    X           // KxT
+    const arma::mat&    U           // NxT structural shocks
 ) {
-  const int N           = Y.n_rows;
-  const int T           = Y.n_cols;
+  const int N           = U.n_rows;
+  const int T           = U.n_cols;
   
-  mat       U           = aux_B * ( Y - aux_A * X );
   vec       s_lambda    = aux_df + 2 + trans(sum( pow(U, 2) ));
   double    nu_lambda   = aux_df + N;
-  vec       aux_lambda  = s_lambda / as<vec>(Rcpp::rchisq(T, nu_lambda));
+  vec       aux_lambda  = s_lambda;
+  for (int t=0; t<T; t++) {
+    aux_lambda(t)      /= rng_rchisq(nu_lambda);
+  }
   
   return aux_lambda;
 } // END sample_lambda
@@ -29,23 +28,45 @@ arma::vec sample_lambda (
 
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
-double log_kernel_df (
+arma::vec sample_lambda (
     const double&       aux_df,
-    const arma::vec&    aux_lambda  // Tx1
+    const arma::mat&    aux_B,      // NxN
+    const arma::mat&    aux_A,      // NxK
+    const arma::mat&    Y,          // NxT
+    const arma::mat&    X           // KxT
+) {
+  return sample_lambda(aux_df, aux_B * ( Y - aux_A * X ));
+} // END sample_lambda
+
+
+double log_kernel_df (
+    const double        aux_df,
+    const int           T,
+    const double        sum_log_lambda,   // accu(log(aux_lambda))
+    const double        sum_inv_lambda    // accu(pow(aux_lambda, -1))
 ) {
   
-  const int T   = aux_lambda.n_elem;
   double lk_df  = 0;
   lk_df   -= T * lgamma(0.5 * aux_df);                        // lambda prior
   lk_df   += 0.5 * T * aux_df * log(0.5 * (aux_df + 2));      // lambda prior
-  lk_df   -= 0.5 * (aux_df + 2) * accu(log(aux_lambda));      // lambda prior
-  lk_df   -= 0.5 * (aux_df + 2) * accu(pow(aux_lambda, -1));  // lambda prior
+  lk_df   -= 0.5 * (aux_df + 2) * sum_log_lambda;             // lambda prior
+  lk_df   -= 0.5 * (aux_df + 2) * sum_inv_lambda;             // lambda prior
   lk_df   -= 2 * log(aux_df + 1);                             // df prior
   
   return lk_df;
 } // END log_kernel_df
 
 
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+double log_kernel_df (
+    const double&       aux_df,
+    const arma::vec&    aux_lambda  // Tx1
+) {
+  return log_kernel_df(aux_df, aux_lambda.n_elem, accu(log(aux_lambda)), accu(pow(aux_lambda, -1)));
+} // END log_kernel_df
+
+
 // [[Rcpp::interfaces(cpp)]]
 // [[Rcpp::export]]
 arma::vec sample_df (
@@ -58,13 +79,18 @@ arma::vec sample_df (
   
   // by sampling from truncated normal it is assumed that the asymmetry from truncation 
   // is negligible for alpha computation
-  double aux_df_star  = RcppTN::rtn1( aux_df, pow(adaptive_scale, 0.5), 0, R_PosInf );
+  double aux_df_star  = rng_rtn( aux_df, pow(adaptive_scale, 0.5), 0, R_PosInf );
+  
+  // the sums over lambda are shared by the kernels at the current and proposed df
+  const int    T              = aux_lambda.n_elem;
+  const double sum_log_lambda = accu(log(aux_lambda));
+  const double sum_inv_lambda = accu(pow(aux_lambda, -1));
   
   double alpha        = 1;
-  double kernel_ratio = exp( log_kernel_df(aux_df_star, aux_lambda) - log_kernel_df(aux_df, aux_lambda) );
+  double kernel_ratio = exp( log_kernel_df(aux_df_star, T, sum_log_lambda, sum_inv_lambda) - log_kernel_df(aux_df, T, sum_log_lambda, sum_inv_lambda) );
   if ( kernel_ratio < 1 ) alpha = kernel_ratio;
   
-  if ( R::runif(0, 1) < alpha ) {
+  if ( rng_unif() < alpha ) {
     aux_df = aux_df_star;
   }
   
@@ -5,6 +5,11 @@
 #include <RcppArmadillo.h>
 
 
+arma::vec sample_lambda (
+    const double&       aux_df,
+    const arma::mat&    U           // NxT structural shocks
+);
+
 arma::vec sample_lambda (
     const double&       aux_df,
     const arma::mat&    aux_B,      // NxN
@@ -14,6 +19,13 @@ arma::vec sample_lambda (
 );
 
 
+double log_kernel_df (
+    const double        aux_df,
+    const int           T,
+    const double        sum_log_lambda,   // accu(log(aux_lambda))
+    const double        sum_inv_lambda    // accu(pow(aux_lambda, -1))
+);
+
 double log_kernel_df (
     const double&       aux_df,
     const arma::vec&    aux_lambda  // Tx1
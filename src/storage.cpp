@@ -0,0 +1,401 @@
+#include <RcppArmadillo.h>
+#include <cstdio>
+
+#include "storage.h"
+
+using namespace Rcpp;
+using namespace arma;
+
+
+
+/*______________________function truncate_file______________________*/
+// keeps the first size bytes of file path by copying them in chunks to a temporary file 
+// that replaces it, which needs no C++17 <filesystem>; returns false if path has fewer 
+// than size bytes or cannot be replaced
+static bool truncate_file (
+    const std::string&  path,
+    const size_t        size
+) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if ( !in || (size_t)in.tellg() < size ) return false;
+  if ( (size_t)in.tellg() == size ) return true;
+  in.seekg(0);
+  
+  const std::string tmp = path + ".tmp";
+  std::ofstream     out(tmp, std::ios::binary | std::ios::trunc);
+  std::vector<char> buffer(1 << 20);
+  size_t            left  = size;
+  while ( left > 0 && in && out ) {
+    const size_t chunk  = std::min(left, buffer.size());
+    in.read(buffer.data(), chunk);
+    out.write(buffer.data(), in.gcount());
+    left               -= in.gcount();
+  }
+  in.close();
+  out.close();
+  if ( left > 0 || !out ) {
+    std::remove(tmp.c_str());
+    return false;
+  }
+  return std::remove(path.c_str()) == 0 && std::rename(tmp.c_str(), path.c_str()) == 0;
+} // END truncate_file
+
+
+/*______________________function read_storage______________________*/
+bsvar_storage read_storage (
+    const Rcpp::List&   storage,
+    const std::string&  model,
+    const int           thin,
+    const bool          resume
+) {
+  bsvar_storage out;
+  out.model         = model;
+  out.thin          = thin;
+  out.resume        = resume;
+  
+  if ( storage.size() == 0 ) return out;
+  if ( !storage.hasAttribute("names") ) {
+    stop("Option bsvars.storage must be a named list.");
+  }
+  
+  const CharacterVector names = storage.names();
+  for (int i=0; i<storage.size(); i++) {
+    const std::string name  = as<std::string>(names[i]);
+    const std::string value = as<std::string>(storage[i]);
+    if ( name == "file" ) {
+      out.file                = value;
+    } else if ( name == "B" ) {
+      stop("The draws of B are always kept in full.");
+    } else {
+      out.modes[name]         = value;
+    }
+  }
+  return out;
+} // END read_storage
+
+
+
+/*______________________class posterior_block______________________*/
+posterior_block::posterior_block (
+    const bsvar_storage& storage,
+    const std::string&  block,
+    const int           n_rows_,
+    const int           n_cols_,
+    const int           S_,
+    const bool          matrix_,
+    const bool          integer_
+) : mode("full"), n_rows(n_rows_), n_cols(n_cols_), S(S_), matrix(matrix_), integer(integer_), count(0) {
+  
+  const auto  it    = storage.modes.find(block);
+  if ( it != storage.modes.end() ) {
+    mode            = it->second;
+  }
+  
+  if ( mode == "full" ) {
+    if ( integer ) {
+      draws_integer.set_size(n_rows, n_cols, S);
+    } else {
+      draws.set_size(n_rows, n_cols, S);
+    }
+  } else if ( mode == "summary" ) {
+    mean.zeros(n_rows, n_cols);
+    m2.zeros(n_rows, n_cols);
+  } else if ( mode == "uint8" ) {
+    if ( !integer ) {
+      stop("Storage mode 'uint8' is available only for the regime indicators; choose another mode for '" + block + "'.");
+    }
+    draws_uint8.resize((size_t)n_rows * n_cols * S);
+  } else if ( mode == "file" ) {
+    if ( storage.file.empty() ) {
+      stop("Storage mode 'file' requires element 'file' of option bsvars.storage with the prefix of the file paths.");
+    }
+    path            = storage.file + block + ".bsvd";
+    if ( storage.resume ) return;     // the file is reopened by restore
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if ( !out ) {
+      stop("Cannot open file " + path + " for writing.");
+    }
+    
+    draws_file_header header;
+    header.n_rows   = n_rows;
+    header.n_cols   = n_cols;
+    header.S        = S;
+    header.thin     = storage.thin;
+    header.matrix   = matrix;
+    header.integer  = integer;
+    storage.model.copy(header.model, sizeof(header.model) - 1);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.flush();
+  } else if ( mode != "none" ) {
+    stop("Storage mode for '" + block + "' must be one of 'full', 'summary', 'uint8', 'file', or 'none'.");
+  }
+} // END posterior_block
+
+
+
+bool posterior_block::kept () const {
+  return mode != "none";
+} // END kept
+
+
+
+void posterior_block::update_summary (
+    const arma::mat&    draw
+) {
+  // Welford's algorithm for the running mean and the sum of squared deviations
+  count++;
+  const mat   delta   = draw - mean;
+  mean               += delta / count;
+  m2                 += delta % (draw - mean);
+} // END update_summary
+
+
+
+void posterior_block::record (
+    const int           s,
+    const arma::mat&    draw
+) {
+  if ( mode == "full" ) {
+    draws.slice(s)    = draw;
+  } else if ( mode == "summary" ) {
+    update_summary(draw);
+  } else if ( mode == "file" ) {
+    // flushed at every draw so that the file holds all the draws recorded before an interruption
+    out.write(reinterpret_cast<const char*>(draw.memptr()), draw.n_elem * sizeof(double));
+    out.flush();
+  }
+} // END record
+
+
+
+void posterior_block::record (
+    const int           s,
+    const arma::umat&   draw
+) {
+  if ( mode == "full" ) {
+    draws_integer.slice(s)  = draw;
+  } else if ( mode == "uint8" || mode == "file" ) {
+    unsigned char*  compact;
+    std::vector<unsigned char> buffer;
+    if ( mode == "uint8" ) {
+      compact               = draws_uint8.data() + (size_t)n_rows * n_cols * s;
+    } else {
+      buffer.resize(draw.n_elem);
+      compact               = buffer.data();
+    }
+    for (uword i=0; i<draw.n_elem; i++) {
+      compact[i]            = static_cast<unsigned char>( std::min<uword>(draw(i), 255) );
+    }
+    if ( mode == "file" ) {
+      out.write(reinterpret_cast<const char*>(compact), draw.n_elem);
+      out.flush();
+    }
+  } else if ( mode == "summary" ) {
+    update_summary(conv_to<mat>::from(draw));
+  }
+} // END record
+
+
+
+SEXP posterior_block::result () const {
+  
+  if ( mode == "full" ) {
+    if ( matrix ) {
+      if ( integer ) {
+        return wrap( umat(draws_integer.memptr(), n_rows, S) );
+      }
+      return wrap( mat(draws.memptr(), n_rows, S) );
+    }
+    if ( integer ) {
+      return wrap(draws_integer);
+    }
+    return wrap(draws);
+  
+  } else if ( mode == "summary" ) {
+    mat   variance(n_rows, n_cols, fill::value(NA_REAL));
+    if ( count > 1 ) {
+      variance          = m2 / (count - 1);
+    }
+    if ( matrix ) {
+      return List::create(
+        _["mean"]       = vec(mean),
+        _["variance"]   = vec(variance),
+        _["draws"]      = count
+      );
+    }
+    return List::create(
+      _["mean"]         = mean,
+      _["variance"]     = variance,
+      _["draws"]        = count
+    );
+  
+  } else if ( mode == "uint8" ) {
+    RawVector raw(draws_uint8.begin(), draws_uint8.end());
+    if ( matrix ) {
+      raw.attr("dim")   = IntegerVector::create(n_rows, S);
+    } else {
+      raw.attr("dim")   = IntegerVector::create(n_rows, n_cols, S);
+    }
+    return raw;
+  
+  } else if ( mode == "file" ) {
+    List  reference = List::create(
+      _["file"]     = path,
+      _["dim"]      = matrix ? IntegerVector::create(n_rows, S) : IntegerVector::create(n_rows, n_cols, S)
+    );
+    reference.attr("class") = "PosteriorDrawsFile";
+    return reference;
+  }
+  
+  return R_NilValue;
+} // END result
+
+
+
+SEXP posterior_block::state (
+    const int           ss
+) const {
+  // only the first ss draws are saved, as the remaining slots are not yet filled
+  if ( mode == "full" ) {
+    if ( matrix ) {
+      if ( integer ) {
+        return wrap( umat(draws_integer.memptr(), n_rows, ss) );
+      }
+      return wrap( mat(draws.memptr(), n_rows, ss) );
+    }
+    if ( integer ) {
+      return wrap( draws_integer.head_slices(ss) );
+    }
+    return wrap( draws.head_slices(ss) );
+  
+  } else if ( mode == "summary" ) {
+    return List::create(
+      _["mean"]         = mean,
+      _["m2"]           = m2,
+      _["draws"]        = count
+    );
+  
+  } else if ( mode == "uint8" ) {
+    RawVector raw(draws_uint8.begin(), draws_uint8.begin() + (size_t)n_rows * n_cols * ss);
+    if ( matrix ) {
+      raw.attr("dim")   = IntegerVector::create(n_rows, ss);
+    } else {
+      raw.attr("dim")   = IntegerVector::create(n_rows, n_cols, ss);
+    }
+    return raw;
+  }
+  return R_NilValue;
+} // END state
+
+
+
+void posterior_block::restore (
+    SEXP                state,
+    const int           ss
+) {
+  const size_t  n_elem  = (size_t)n_rows * n_cols * ss;
+  
+  if ( mode == "full" ) {
+    const NumericVector saved(state);
+    if ( (size_t)saved.size() < n_elem ) {
+      stop("The checkpoint does not match the dimensions of the posterior draws.");
+    }
+    if ( integer ) {
+      for (size_t i=0; i<n_elem; i++) draws_integer(i) = saved[i];
+    } else {
+      std::copy(saved.begin(), saved.begin() + n_elem, draws.memptr());
+    }
+  
+  } else if ( mode == "summary" ) {
+    const List  saved(state);
+    mean                = as<mat>(saved["mean"]);
+    m2                  = as<mat>(saved["m2"]);
+    count               = as<int>(saved["draws"]);
+  
+  } else if ( mode == "uint8" ) {
+    const RawVector saved(state);
+    std::copy(saved.begin(), saved.begin() + n_elem, draws_uint8.begin());
+  
+  } else if ( mode == "file" ) {
+    std::ifstream in(path, std::ios::binary);
+    draws_file_header header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if ( !in || std::string(header.magic, 8) != "BSVARSD1" || header.n_rows != n_rows || header.n_cols != n_cols || header.S != S ) {
+      stop("File " + path + " does not contain the posterior draws of the checkpointed run.");
+    }
+    
+    // the draws recorded after the checkpoint are dropped, and the next ones are appended
+    const size_t  elem_size = integer ? 1 : sizeof(double);
+    const size_t  size      = sizeof(header) + n_elem * elem_size;
+    in.seekg(0, std::ios::end);
+    if ( (size_t)in.tellg() < size ) {
+      stop("File " + path + " has fewer posterior draws than the checkpoint.");
+    }
+    in.close();
+    if ( !truncate_file(path, size) ) {
+      stop("Cannot truncate file " + path + " to the draws of the checkpoint.");
+    }
+    out.open(path, std::ios::binary | std::ios::app);
+    if ( !out ) {
+      stop("Cannot open file " + path + " for writing.");
+    }
+  }
+} // END restore
+
+
+
+/*______________________function read_draws_file_cpp______________________*/
+// reads the draws stored by a block in mode "file"; the draws are read one at a time
+// from their positions in the file, and only column col of each of them if col >= 0,
+// e.g., the last-period volatilities needed for forecasting; a file of an interrupted
+// run gives the draws completed before the interruption
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+SEXP read_draws_file_cpp (
+    const std::string&  file,
+    const int           col = -1
+) {
+  std::ifstream in(file, std::ios::binary);
+  if ( !in ) {
+    stop("Cannot open file " + file + ".");
+  }
+  
+  draws_file_header header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if ( !in || std::string(header.magic, 8) != "BSVARSD1" ) {
+    stop("File " + file + " does not contain posterior draws.");
+  }
+  if ( col >= header.n_cols ) {
+    stop("Argument col exceeds the number of columns of the draws.");
+  }
+  
+  in.seekg(0, std::ios::end);
+  const size_t  file_size   = in.tellg();
+  const size_t  elem_size   = header.integer ? 1 : sizeof(double);
+  const size_t  draw_size   = (size_t)header.n_rows * header.n_cols * elem_size;
+  const int     S           = std::min<size_t>((file_size - sizeof(header)) / draw_size, header.S);
+  
+  const int     first_col   = col < 0 ? 0 : col;
+  const int     n_cols      = col < 0 ? header.n_cols : 1;
+  const size_t  n_elem      = (size_t)header.n_rows * n_cols;
+  
+  cube          draws(header.n_rows, n_cols, S);
+  std::vector<unsigned char> buffer(n_elem);
+  for (int s=0; s<S; s++) {
+    in.seekg(sizeof(header) + s * draw_size + (size_t)first_col * header.n_rows * elem_size);
+    if ( header.integer ) {
+      in.read(reinterpret_cast<char*>(buffer.data()), n_elem);
+      for (size_t i=0; i<n_elem; i++) {
+        draws.slice(s)(i)   = buffer[i];
+      }
+    } else {
+      in.read(reinterpret_cast<char*>(draws.slice(s).memptr()), n_elem * sizeof(double));
+    }
+  } // END s loop
+  
+  if ( header.matrix || col >= 0 ) {
+    const mat   out(draws.memptr(), header.n_rows, S);
+    return header.integer ? wrap(conv_to<umat>::from(out)) : wrap(out);
+  }
+  return header.integer ? wrap(conv_to<ucube>::from(draws)) : wrap(draws);
+} // END read_draws_file_cpp
@@ -0,0 +1,100 @@
+#ifndef _STORAGE_H_
+#define _STORAGE_H_
+
+#include <RcppArmadillo.h>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+
+// The storage modes of the posterior blocks converted from the R list once per run.
+// The list has an element named after every block stored in a mode other than "full"
+// and element file with the prefix of the paths of the blocks stored in mode "file"
+struct bsvar_storage {
+  std::map<std::string, std::string> modes;
+  std::string   file;
+  std::string   model;
+  int           thin        = 1;
+  bool          resume      = false;  // the blocks are restored from a checkpoint
+};
+
+
+bsvar_storage read_storage (
+    const Rcpp::List&   storage,
+    const std::string&  model,
+    const int           thin,
+    const bool          resume = false
+);
+
+
+// The header of the binary file with the draws of a block followed by the draws,
+// n_rows x n_cols values each in the column-major order, stored as double or as
+// unsigned char for the integer blocks
+struct draws_file_header {
+  char          magic[8]    = {'B','S','V','A','R','S','D','1'};
+  int32_t       n_rows      = 0;
+  int32_t       n_cols      = 0;
+  int32_t       S           = 0;    // the number of draws of a complete run
+  int32_t       thin        = 1;
+  int32_t       matrix      = 0;
+  int32_t       integer     = 0;
+  char          model[24]   = {0};
+};
+
+
+// The draws of one block of parameters kept by the samplers. The storage mode of the block 
+// is one of:
+//   "full"    - all draws in an array as previously, the default
+//   "summary" - the running mean and variance of every element only
+//   "uint8"   - all draws using one byte per element, for the regime indicators S only
+//   "file"    - all draws written to a binary file as they are recorded so that they are
+//               kept if the run is interrupted and need not fit in memory
+//   "none"    - nothing, e.g., for sigma that can be computed from other parameters
+// The draws are recorded on the main thread. The state of a block after recording ss draws 
+// is saved in the checkpoints and restored from them by restore, which for mode "file" 
+// drops the draws written to the file after the checkpoint.
+class posterior_block {
+  public:
+    posterior_block (
+      const bsvar_storage& storage,
+      const std::string&  block,
+      const int           n_rows,
+      const int           n_cols,         // 1 for the blocks stored as n_rows x S matrices
+      const int           S,
+      const bool          matrix = false, // the draws of the block are vectors
+      const bool          integer = false // the draws of the block are non-negative integers
+    );
+    
+    bool  kept () const;                  // anything is recorded
+    void  record (const int s, const arma::mat& draw);
+    void  record (const int s, const arma::umat& draw);
+    SEXP  result () const;
+    SEXP  state (const int ss) const;    // the first ss draws
+    void  restore (SEXP state, const int ss);
+    
+  private:
+    void  update_summary (const arma::mat& draw);
+    
+    std::string   mode;
+    int           n_rows, n_cols, S;
+    bool          matrix, integer;
+    
+    arma::cube    draws;
+    arma::ucube   draws_integer;
+    std::vector<unsigned char> draws_uint8;
+    arma::mat     mean, m2;
+    int           count;
+    std::string   path;
+    std::ofstream out;
+};
+
+
+SEXP read_draws_file_cpp (
+    const std::string&  file,
+    const int           col = -1          // read only column col of every draw if non-negative
+);
+
+
+#endif  // _STORAGE_H_
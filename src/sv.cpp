@@ -3,10 +3,28 @@
 #include "Rcpp/Rmath.h"
 #include <RcppTN.h>
 
+#include "prior.h"
+#include "rng.h"
+
 using namespace Rcpp;
 using namespace arma;
 
 
+// the 10-component normal mixture approximating the log chi-squared(1) distribution:
+// means and inverse variances, and the component log-weights log(p_r) - 0.5 * log(v_r)
+// and constants 0.5 / v_r of the mixture densities precomputed from the probabilities p_r
+// {0.00609,0.04775,0.13057,0.20674,0.22715,0.18842,0.12047,0.05591,0.01575,0.00115} 
+// and variances v_r {0.11265,0.17788,0.26768,0.40611,0.62699,0.98583,1.57469,2.54498,4.16591,7.33342}
+static constexpr int    sv_mix_R = 10;
+static constexpr double sv_mix_mean[sv_mix_R]         = {1.92677,1.34744,0.73504,0.02266,-0.85173,-1.97278,-3.46788,-5.55246,-8.68384,-14.65000};
+static constexpr double sv_mix_inv_var[sv_mix_R]      = {8.87705281846427,5.62176748369687,3.73580394500897,2.46238703799463,1.59492176908723,
+                                                         1.01437367497439,0.635045628028374,0.392930396309598,0.240043591916292,0.136362024812434};
+static constexpr double sv_mix_log_weight[sv_mix_R]   = {-4.00937239120839,-2.17845315538558,-1.37686427669038,-1.12572770378363,-1.24873234305686,
+                                                         -1.66194608884283,-2.34338373345743,-3.3510734196563,-4.86438228328493,-7.76421432800807};
+static constexpr double sv_mix_half_inv_var[sv_mix_R] = {4.43852640923213,2.81088374184844,1.86790197250448,1.23119351899732,0.797460884543613,
+                                                         0.507186837487194,0.317522814014187,0.196465198154799,0.120021795958146,0.068181012406217};
+
+
 
 /*______________________function do_rgig1______________________*/
 // utility function copied from package factorstochvol
@@ -85,6 +103,37 @@ arma::vec backward_algorithm(
 
 
 
+/*______________________function precision_sampler_ar1_inplace______________________*/
+// a draw from N(P^{-1} location, P^{-1}) for the TxT tridiagonal precision P with diagonal 
+// precision_diag and constant off-diagonal precision_offdiag; the Cholesky factor, the forward 
+// solve, and the standard normal noise are computed in one pass and followed by the backward 
+// solve; draw holds the location on input and the draw on output, work T diagonal elements
+// of the Cholesky factor
+void precision_sampler_ar1_inplace (
+    double*             draw,               // T
+    double*             work,               // T
+    const double*       precision_diag,     // T
+    const double        precision_offdiag,
+    const int           T
+) {
+  work[0]             = std::sqrt(precision_diag[0]);
+  double  aa          = draw[0] / work[0];
+  draw[0]             = aa + rng_norm(0, 1);
+  for (int j = 1; j < T; j++) {
+    const double chol_offdiag = precision_offdiag / work[j-1];
+    work[j]           = std::sqrt(precision_diag[j] - chol_offdiag * chol_offdiag);
+    aa                = (draw[j] - chol_offdiag * aa) / work[j];
+    draw[j]           = aa + rng_norm(0, 1);
+  }
+  
+  draw[T-1]           = draw[T-1] / work[T-1];
+  for (int j = T-2; j >= 0; j--) {
+    draw[j]           = (draw[j] - precision_offdiag / work[j] * draw[j+1]) / work[j];
+  }
+} // END precision_sampler_ar1_inplace
+
+
+
 /*______________________function precision_sampler_ar1______________________*/
 // utility function from file precision_sampler.cpp
 // [[Rcpp::interfaces(cpp)]]
@@ -94,20 +143,144 @@ arma::vec precision_sampler_ar1(
     const double&        precision_offdiag,
     const arma::vec&     location
 ) {
-  int T               = location.n_rows;
-  vec  epsilon(T, fill::randn);
-  List precision_chol = cholesky_tridiagonal(precision_diag, precision_offdiag);    // Cholesky decomposition using a dedicated technique
-  vec  aa             = forward_algorithm(precision_chol["chol_diag"],              // this forward substitution can be performed outside of the loop
-                                          precision_chol["chol_offdiag"],
-                                                        location);
-  vec draw_ssar1      = backward_algorithm(precision_chol["chol_diag"],
-                                           precision_chol["chol_offdiag"],
-                                                         aa + epsilon);     // this has to be done in the loop as function backward_algorithm requires covector to be a vector (not a matrix)
+  const int T         = location.n_rows;
+  vec  draw_ssar1     = location;
+  vec  work(T);
+  precision_sampler_ar1_inplace(draw_ssar1.memptr(), work.memptr(), precision_diag.memptr(), precision_offdiag, T);
   return draw_ssar1;
 } // END precision_sampler_ar1
 
 
 
+/*______________________function precision_sampler_ar1_interleaved______________________*/
+// N draws as in precision_sampler_ar1_inplace stored column-interleaved, i.e., element t of 
+// path n at n + N * t, so that the recursions run over t while the inner loops over n 
+// are contiguous; work N * (T + 1) elements, the noise is drawn backwards in t
+static void precision_sampler_ar1_interleaved (
+    double*             draw,               // N*T
+    double*             work,               // N*(T+1)
+    const double*       precision_diag,     // N*T
+    const double*       precision_offdiag,  // N
+    const int           N,
+    const int           T
+) {
+  double* chol_diag   = work;               // N*T
+  double* epsilon     = work + N * T;       // N
+  
+  for (int n = 0; n < N; n++) {
+    chol_diag[n]      = std::sqrt(precision_diag[n]);
+    draw[n]          /= chol_diag[n];
+  }
+  for (int t = 1; t < T; t++) {
+    const double* L_m = chol_diag + N * (t-1);
+    const double* a_m = draw + N * (t-1);
+    double*       L_t = chol_diag + N * t;
+    double*       a_t = draw + N * t;
+    const double* P_t = precision_diag + N * t;
+    for (int n = 0; n < N; n++) {
+      const double chol_offdiag = precision_offdiag[n] / L_m[n];
+      L_t[n]          = std::sqrt(P_t[n] - chol_offdiag * chol_offdiag);
+      a_t[n]          = (a_t[n] - chol_offdiag * a_m[n]) / L_t[n];
+    }
+  }
+  
+  for (int t = T-1; t >= 0; t--) {
+    const double* L_t = chol_diag + N * t;
+    double*       h_t = draw + N * t;
+    for (int n = 0; n < N; n++) epsilon[n] = rng_norm(0, 1);
+    if ( t == T-1 ) {
+      for (int n = 0; n < N; n++) {
+        h_t[n]        = (h_t[n] + epsilon[n]) / L_t[n];
+      }
+    } else {
+      const double* h_p = draw + N * (t+1);
+      for (int n = 0; n < N; n++) {
+        h_t[n]        = (h_t[n] + epsilon[n] - precision_offdiag[n] / L_t[n] * h_p[n]) / L_t[n];
+      }
+    }
+  }
+} // END precision_sampler_ar1_interleaved
+
+
+
+/*______________________function precision_sampler_ar1_batch______________________*/
+// N independent draws as in precision_sampler_ar1 in one column-interleaved pass
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+arma::mat precision_sampler_ar1_batch (
+    const arma::mat&     precision_diag,      // NxT
+    const arma::vec&     precision_offdiag,   // N
+    const arma::mat&     location             // NxT
+) {
+  const int N         = location.n_rows;
+  const int T         = location.n_cols;
+  if ( precision_diag.n_rows != location.n_rows || precision_diag.n_cols != location.n_cols || (int)precision_offdiag.n_elem != N ) {
+    stop("Arguments precision_diag, precision_offdiag, and location have incompatible dimensions.");
+  }
+  mat  draw           = location;
+  vec  work(N * (T + 1));
+  precision_sampler_ar1_interleaved(draw.memptr(), work.memptr(), precision_diag.memptr(), precision_offdiag.memptr(), N, T);
+  return draw;
+} // END precision_sampler_ar1_batch
+
+
+
+/*______________________function mixture_indicator_cdf______________________*/
+// the non-normalised CDFs of the mixture indicators of n elements of datanorm written 
+// to the 10xn block cdf: the log-densities log(p_r) - 0.5 log(v_r) - 0.5 (x - m_r)^2 / v_r 
+// of the mixture components are computed in a loop with a fixed trip count, shifted by 
+// their column maximum, and exponentiated over the whole block at once
+static void mixture_indicator_cdf (
+    double*           cdf,                // 10*n
+    const double*     datanorm,           // n
+    const int         n
+) {
+  mat   kernel(cdf, sv_mix_R, n, false, true);
+  for (int t=0; t<n; t++) {
+    const double  x   = datanorm[t];
+    double*       k_t = kernel.colptr(t);
+    double        k_max = -datum::inf;
+    for (int r=0; r<sv_mix_R; r++) {
+      const double  d = x - sv_mix_mean[r];
+      k_t[r]          = sv_mix_log_weight[r] - d * d * sv_mix_half_inv_var[r];
+      k_max           = std::max(k_max, k_t[r]);
+    }
+    for (int r=0; r<sv_mix_R; r++) {
+      k_t[r]         -= k_max;
+    }
+  }
+  kernel              = exp(kernel);
+  for (int t=0; t<n; t++) {
+    double*       k_t = kernel.colptr(t);
+    for (int r=1; r<sv_mix_R; r++) {
+      k_t[r]         += k_t[r-1];
+    }
+  }
+} // END mixture_indicator_cdf
+
+
+
+/*______________________function mixture_indicator_draw______________________*/
+// draws n indicators from the non-normalised CDFs in the 10xn block cdf; the index 
+// of the component is the number of CDF values below the uniform draw
+static void mixture_indicator_draw (
+    arma::uword*      draw,               // n
+    const double*     cdf,                // 10*n
+    const int         n
+) {
+  for (int t=0; t<n; t++) {
+    const double* cdf_t = cdf + sv_mix_R * t;
+    const double  u     = rng_unif() * cdf_t[sv_mix_R - 1];
+    uword         index = 0;
+    for (int r=0; r<sv_mix_R - 1; r++) {
+      index            += (u > cdf_t[r]);
+    }
+    draw[t]             = index;
+  }
+} // END mixture_indicator_draw
+
+
+
 /*______________________function inverse_transform_sampling______________________*/
 // utility function from file utils_latent_states.cc from the source code of package stochvol
 // [[Rcpp::interfaces(cpp)]]
@@ -117,30 +290,9 @@ arma::uvec inverse_transform_sampling (
     const int         T
 ) {
   uvec r(T);
-  for (int j = 0; j < T; j++) {
-    int index = (10-1)/2;  // start searching in the middle
-    const double unnorm_cdf_value = R::unif_rand()*mixprob[9 + 10*j];  // current (non-normalized) value
-    bool larger = false;  // indicates that we already went up
-    bool smaller = false; // indicates that we already went down
-    while(true) {
-      if (unnorm_cdf_value > mixprob[index +  10*j]) {
-        index++;
-        if (smaller) {
-          break;
-        } else {
-          larger = true;
-        }
-      } else if (larger || index == 0) {
-        break;
-      } else {
-        index--;
-        smaller = true;
-      }
-    }
-    r[j] = index;
-  }
+  mixture_indicator_draw(r.memptr(), mixprob.memptr(), T);
   return r;
-}
+} // END inverse_transform_sampling
 
 
 
@@ -151,106 +303,165 @@ arma::uvec inverse_transform_sampling (
 arma::vec find_mixture_indicator_cdf (
   const arma::vec& datanorm           // provide all that is conditionally normal
 ){
-  // fixed values for auxiliary mixture
-  const NumericVector alpha_s = NumericVector::create(1.92677,1.34744,0.73504,0.02266,0-0.85173,-1.97278,-3.46788,-5.55246,-8.68384,-14.65000);
-  const NumericVector sigma_s = NumericVector::create(0.11265,0.17788,0.26768,0.40611,0.62699,0.98583,1.57469,2.54498,4.16591,7.33342);
-  const NumericVector pr_s    = NumericVector::create(0.00609,0.04775,0.13057,0.20674,0.22715,0.18842,0.12047,0.05591,0.01575,0.00115);
-  
   const int T = datanorm.n_elem;
-  vec mixprob(10 * T);
-  for (int j = 0; j < T; j++) {  // TODO slow (10*T calls to exp)!
-    const int first_index = 10*j;
-    mixprob(first_index) = std::exp(pr_s(0) - (datanorm(j) - alpha_s(0)) * (datanorm(j) - alpha_s(0)) / sigma_s(0) );
-    for (int r = 1; r < 10; r++) {
-      mixprob(first_index+r) = mixprob(first_index+r-1) + std::exp(pr_s(r) - (datanorm(j) - alpha_s(r)) * (datanorm(j) - alpha_s(r)) / sigma_s(r) );
-    }
-  }
+  vec mixprob(sv_mix_R * T);
+  mixture_indicator_cdf(mixprob.memptr(), datanorm.memptr(), T);
   return mixprob;
-}
+} // END find_mixture_indicator_cdf
+
+
+
+/*______________________function sample_sv_update1______________________*/
+// a draw of the log-volatility at T+1 given the one at T and the structural shock at T+1 
+// under the auxiliary mixture: the component is drawn from its distribution marginalised 
+// over the log-volatility, and the log-volatility from its conditional normal distribution
+double sample_sv_update1 (
+    const double    h_T,
+    const double    u,                  // the structural shock at T+1
+    const double    rho,
+    const double    omega,
+    const bool      centred_sv
+) {
+  const double    ccc       = 0.000000001;      // a constant to make log((u+ccc)^2) feasible
+  const double    y         = std::log(std::pow(u + ccc, 2));
+  
+  // the prior of h_T+1 is N(rho * h_T, var_0) and log(u^2) = loading * h_T+1 + mixture
+  const double    mean_0    = rho * h_T;
+  const double    var_0     = centred_sv ? omega * omega : 1;
+  const double    loading   = centred_sv ? 1 : omega;
+  
+  double          log_prob[sv_mix_R];
+  double          log_prob_max  = -datum::inf;
+  for (int r=0; r<sv_mix_R; r++) {
+    const double  var_r     = 1 / sv_mix_inv_var[r];
+    const double  var_y     = loading * loading * var_0 + var_r;
+    const double  d         = y - sv_mix_mean[r] - loading * mean_0;
+    log_prob[r]             = sv_mix_log_weight[r] + 0.5 * std::log(var_r / var_y) - 0.5 * d * d / var_y;
+    log_prob_max            = std::max(log_prob_max, log_prob[r]);
+  }
+  for (int r=0; r<sv_mix_R; r++) {
+    log_prob[r]             = std::exp(log_prob[r] - log_prob_max);
+  }
+  const int       r         = rng_categorical(log_prob, sv_mix_R);
+  
+  const double    precision = 1 / var_0 + loading * loading * sv_mix_inv_var[r];
+  const double    location  = mean_0 / var_0 + loading * (y - sv_mix_mean[r]) * sv_mix_inv_var[r];
+  return location / precision + rng_norm(0, 1) / std::sqrt(precision);
+} // END sample_sv_update1
+
+
+
+/*______________________function read_sv_state______________________*/
+sv_state read_sv_state (
+    const Rcpp::List& starting_values     // a list of starting values
+) {
+  sv_state state;
+  state.h             = trans(as<mat>(starting_values["h"]));
+  state.S             = trans(as<umat>(starting_values["S"]));
+  state.rho           = as<vec>(starting_values["rho"]);
+  state.omega         = as<vec>(starting_values["omega"]);
+  state.sigma2v       = as<vec>(starting_values["sigma2v"]);
+  state.sigma2_omega  = as<vec>(starting_values["sigma2_omega"]);
+  state.s_            = as<vec>(starting_values["s_"]);
+  return state;
+} // END read_sv_state
+
+
+
+// h * H_rho' * H_rho * h' = h_1^2 + sum_t (h_t - rho * h_t-1)^2 without forming the TxT matrix H_rho
+static double ar1_quadratic_form (
+    const arma::rowvec& h,                // 1xT
+    const double        rho
+) {
+  const int T   = h.n_elem;
+  double    out = h(0) * h(0);
+  for (int t=1; t<T; t++) {
+    const double e  = h(t) - rho * h(t-1);
+    out            += e * e;
+  }
+  return out;
+} // END ar1_quadratic_form
 
 
 
 /*______________________function svar_nc1______________________*/
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
-Rcpp::List svar_nc1 (
-  arma::rowvec&   aux_h_n,            // 1xT
-  double&         aux_rho_n,
-  double&         aux_omega_n,
-  double&         aux_sigma2v_n,
-  double&         aux_sigma2_omega_n, // omega prior hyper-parameter 
-  double&         aux_s_n,             // scale of IG2 prior for aux_sigma2_omega_n
-  arma::urowvec&  aux_S_n,            // 1xT
-  const arma::rowvec&   u,                  // 1xT
-  const Rcpp::List&     prior,
-  bool            sample_s_ = true
+void svar_nc1 (
+  sv_state&             state,        // SV states of all equations, equation n is updated in place
+  const int             n,            // equation index
+  const arma::rowvec&   u,            // 1xT
+  const bsvar_prior&    prior,
+  const bool            sample_s_
 ) {
   // sampler for the non-centred parameterisation of the SV process
   
-  // fixed values for auxiliary mixture
-  const NumericVector alpha_s = NumericVector::create(1.92677,1.34744,0.73504,0.02266,0-0.85173,-1.97278,-3.46788,-5.55246,-8.68384,-14.65000);
-  const NumericVector sigma_s = NumericVector::create(0.11265,0.17788,0.26768,0.40611,0.62699,0.98583,1.57469,2.54498,4.16591,7.33342);
-  const NumericVector pr_s    = NumericVector::create(0.00609,0.04775,0.13057,0.20674,0.22715,0.18842,0.12047,0.05591,0.01575,0.00115);
   const double        ccc     = 0.000000001;      // a constant to make log((u+ccc)^2) feasible
   
   // sample h and omega of the non-centered SV including ASIS step
   const int     T = u.n_cols;
   const rowvec  U = log(pow(u + ccc, 2));
   
-  const double  prior_sv_a_ = prior["sv_a_"];
-  const double  prior_sv_s_ = prior["sv_s_"];
+  const double  prior_sv_a_ = prior.sv_a_;
+  const double  prior_sv_s_ = prior.sv_s_;
   
-  mat           H_rho(T, T, fill::eye);
-  H_rho.diag(-1)       -= aux_rho_n;
-  mat           HH_rho  = H_rho.t() * H_rho;
+  // the state of equation n used in place
+  rowvec    aux_h_n(state.h.colptr(n), T, false, true);           // 1xT
+  urowvec   aux_S_n(state.S.colptr(n), T, false, true);           // 1xT
+  double&   aux_rho_n           = state.rho(n);
+  double&   aux_omega_n         = state.omega(n);
+  double&   aux_sigma2v_n       = state.sigma2v(n);
+  double&   aux_sigma2_omega_n  = state.sigma2_omega(n);          // omega prior hyper-parameter
+  double&   aux_s_n             = state.s_(n);                    // scale of IG2 prior for aux_sigma2_omega_n
   
   // sample auxiliary mixture states aux_S
-  const vec   mixprob   = find_mixture_indicator_cdf(trans(U - aux_omega_n*aux_h_n));
-  aux_S_n               = trans(inverse_transform_sampling(mixprob, T));
+  const rowvec  datanorm  = U - aux_omega_n*aux_h_n;
+  vec       mixprob(sv_mix_R * T);
+  mixture_indicator_cdf(mixprob.memptr(), datanorm.memptr(), T);
+  mixture_indicator_draw(aux_S_n.memptr(), mixprob.memptr(), T);
   
   rowvec    alpha_S(T);
   rowvec    sigma_S_inv(T);
   for (int t=0; t<T; t++) {
-    alpha_S.col(t)      = alpha_s(aux_S_n(t));
-    sigma_S_inv.col(t)  = 1/sigma_s(aux_S_n(t));
+    alpha_S(t)          = sv_mix_mean[aux_S_n(t)];
+    sigma_S_inv(t)      = sv_mix_inv_var[aux_S_n(t)];
   }
   
   // sample aux_s_n
   if ( sample_s_ ) {
-    aux_s_n               = (prior_sv_s_ + 2 * aux_sigma2_omega_n)/chi2rnd(3 + 2 * prior_sv_a_);
+    aux_s_n               = (prior_sv_s_ + 2 * aux_sigma2_omega_n)/rng_chi2rnd(3 + 2 * prior_sv_a_);
   }
   
   // sample aux_sigma2_omega
-  aux_sigma2_omega_n    = do_rgig1( prior_sv_a_-0.5, pow(aux_omega_n,2), 2/aux_s_n );
+  aux_sigma2_omega_n    = rng_rgig( prior_sv_a_-0.5, pow(aux_omega_n,2), 2/aux_s_n );
   
   // sample aux_rho
   rowvec    hm1         = aux_h_n.cols(0,T-2);
   double    aux_rho_var = as_scalar(pow(hm1*hm1.t(), -1));
   double    aux_rho_mean = as_scalar(aux_rho_var * hm1*aux_h_n.cols(1,T-1).t());
   double    upper_bound = pow(1-aux_sigma2_omega_n, 0.5);
-  aux_rho_n             = RcppTN::rtn1(aux_rho_mean, pow(aux_rho_var, 0.5),-upper_bound,upper_bound);
+  aux_rho_n             = rng_rtn(aux_rho_mean, pow(aux_rho_var, 0.5),-upper_bound,upper_bound);
   
-  mat       H_rho_new(T, T, fill::eye);
-  H_rho_new.diag(-1)   -= aux_rho_n;
-  H_rho                 = H_rho_new;
-  HH_rho                = H_rho_new.t() * H_rho_new;
+  // H_rho' * H_rho is tridiagonal with diagonal 1 + rho^2, the last element 1, and off-diagonal -rho
+  vec       HH_rho_diag(T);
+  HH_rho_diag.fill(1 + pow(aux_rho_n, 2));
+  HH_rho_diag(T-1)      = 1;
   
   // sample aux_omega
-  double    V_omega_inv = 1/( as_scalar(aux_h_n * diagmat(sigma_S_inv) * aux_h_n.t()) + pow(aux_sigma2_omega_n, -1) );
-  double    omega_bar   = as_scalar(aux_h_n * diagmat(sigma_S_inv) * (U - alpha_S).t());
-  double    omega_aux   = randn( distr_param(V_omega_inv*omega_bar, sqrt(V_omega_inv) ));
+  double    V_omega_inv = 1/( accu(square(aux_h_n) % sigma_S_inv) + pow(aux_sigma2_omega_n, -1) );
+  double    omega_bar   = accu(aux_h_n % sigma_S_inv % (U - alpha_S));
+  double    omega_aux   = rng_norm( V_omega_inv*omega_bar, sqrt(V_omega_inv) );
   
   // sample aux_h
-  mat       V_h         = pow(omega_aux, 2) * diagmat(sigma_S_inv) + HH_rho;
-  vec       h_bar       = omega_aux * diagmat(sigma_S_inv) * (U - alpha_S).t();
-  rowvec    h_aux       = trans(precision_sampler_ar1( V_h.diag(), V_h(1, 0), h_bar));
+  vec       V_h_diag    = pow(omega_aux, 2) * trans(sigma_S_inv) + HH_rho_diag;
+  rowvec    h_aux       = omega_aux * (sigma_S_inv % (U - alpha_S));
+  vec       work(T);
+  precision_sampler_ar1_inplace(h_aux.memptr(), work.memptr(), V_h_diag.memptr(), -aux_rho_n, T);
   
   // ASIS
   rowvec    aux_h_tilde = omega_aux * h_aux;
-  double    hHHh        = as_scalar( aux_h_tilde * HH_rho * aux_h_tilde.t() );
-  aux_sigma2v_n         = do_rgig1( -0.5*(T-1), hHHh, 1/aux_sigma2_omega_n );
+  double    hHHh        = ar1_quadratic_form(aux_h_tilde, aux_rho_n);
+  aux_sigma2v_n         = rng_rgig( -0.5*(T-1), hHHh, 1/aux_sigma2_omega_n );
   int       ss=1;
-  if (R::runif(0,1)<0.5) ss *= -1;
+  if (rng_unif()<0.5) ss *= -1;
   aux_omega_n           = ss * sqrt(aux_sigma2v_n);
   aux_h_n               = aux_h_tilde / aux_omega_n;
   
@@ -259,93 +470,124 @@ Rcpp::List svar_nc1 (
   aux_rho_var           = as_scalar(pow(hm1*hm1.t(), -1));
   aux_rho_mean          = as_scalar(aux_rho_var * hm1*aux_h_n.cols(1,T-1).t());
   upper_bound           = pow(1-aux_sigma2_omega_n, 0.5);
-  aux_rho_n             = RcppTN::rtn1(aux_rho_mean, pow(aux_rho_var, 0.5),-upper_bound,upper_bound);
-  
-  return List::create(
-    _["aux_h_n"]              = aux_h_n,
-    _["aux_rho_n"]            = aux_rho_n,
-    _["aux_omega_n"]          = aux_omega_n,
-    _["aux_sigma2v_n"]        = aux_sigma2v_n,
-    _["aux_sigma2_omega_n"]   = aux_sigma2_omega_n,
-    _["aux_s_n"]              = aux_s_n,
-    _["aux_S_n"]              = aux_S_n
-  );
-} // END sv_nc1
+  aux_rho_n             = rng_rtn(aux_rho_mean, pow(aux_rho_var, 0.5),-upper_bound,upper_bound);
+} // END svar_nc1
 
 
 
 /*______________________function svar_ce1______________________*/
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
-Rcpp::List svar_ce1 (
-    arma::rowvec&       aux_h_n,            // 1xT
-    double&             aux_rho_n,
-    double&             aux_omega_n,
-    double&             aux_sigma2v_n,
-    double&             aux_sigma2_omega_n, // omega prior hyper-parameter 
-    double&             aux_s_n,             // scale of IG2 prior for aux_sigma2_omega_n
-    arma::urowvec&      aux_S_n,            // 1xT
-    const arma::rowvec& u,                  // 1xT
-    const Rcpp::List&   prior,
-    bool                sample_s_ = true
+void svar_ce1 (
+  sv_state&             state,        // SV states of all equations, equation n is updated in place
+  const int             n,            // equation index
+  const arma::rowvec&   u,            // 1xT
+  const bsvar_prior&    prior,
+  const bool            sample_s_
 ) {
   // sampler for the centred parameterisation of the SV process
   
-  // fixed values for auxiliary mixture
-  const NumericVector alpha_s = NumericVector::create(1.92677,1.34744,0.73504,0.02266,0-0.85173,-1.97278,-3.46788,-5.55246,-8.68384,-14.65000);
-  const NumericVector sigma_s = NumericVector::create(0.11265,0.17788,0.26768,0.40611,0.62699,0.98583,1.57469,2.54498,4.16591,7.33342);
-  const NumericVector pr_s    = NumericVector::create(0.00609,0.04775,0.13057,0.20674,0.22715,0.18842,0.12047,0.05591,0.01575,0.00115);
   const double        ccc     = 0.000000001;      // a constant to make log((u+ccc)^2) feasible
   
   // sample h and omega of the non-centered SV including ASIS step
   const int     T = u.n_cols;
   const rowvec  U = log(pow(u + ccc, 2));
   
-  const double  prior_sv_a_ = prior["sv_a_"];
-  const double  prior_sv_s_ = prior["sv_s_"];
+  const double  prior_sv_a_ = prior.sv_a_;
+  const double  prior_sv_s_ = prior.sv_s_;
   
-  mat           H_rho(T, T, fill::eye);
-  H_rho.diag(-1)       -= aux_rho_n;
-  mat           HH_rho  = H_rho.t() * H_rho;
+  // the state of equation n used in place
+  rowvec    aux_h_n(state.h.colptr(n), T, false, true);           // 1xT
+  urowvec   aux_S_n(state.S.colptr(n), T, false, true);           // 1xT
+  double&   aux_rho_n           = state.rho(n);
+  double&   aux_omega_n         = state.omega(n);
+  double&   aux_sigma2v_n       = state.sigma2v(n);
+  double&   aux_sigma2_omega_n  = state.sigma2_omega(n);          // omega prior hyper-parameter
+  double&   aux_s_n             = state.s_(n);                    // scale of IG2 prior for aux_sigma2_omega_n
   
   // sample auxiliary mixture states aux_S
-  const vec   mixprob   = find_mixture_indicator_cdf(trans(U - aux_omega_n*aux_h_n));
-  aux_S_n               = trans(inverse_transform_sampling(mixprob, T));
+  const rowvec  datanorm  = U - aux_omega_n*aux_h_n;
+  vec       mixprob(sv_mix_R * T);
+  mixture_indicator_cdf(mixprob.memptr(), datanorm.memptr(), T);
+  mixture_indicator_draw(aux_S_n.memptr(), mixprob.memptr(), T);
   
   rowvec    alpha_S(T);
   rowvec    sigma_S_inv(T);
   for (int t=0; t<T; t++) {
-    alpha_S.col(t)      = alpha_s(aux_S_n(t));
-    sigma_S_inv.col(t)  = 1/sigma_s(aux_S_n(t));
+    alpha_S(t)          = sv_mix_mean[aux_S_n(t)];
+    sigma_S_inv(t)      = sv_mix_inv_var[aux_S_n(t)];
   }
   
   // sample aux_s_n
   if ( sample_s_ ) {
-    aux_s_n               = (1 + 2 * aux_sigma2_omega_n) / chi2rnd(3 + 2 * prior_sv_a_);
+    aux_s_n               = (1 + 2 * aux_sigma2_omega_n) / rng_chi2rnd(3 + 2 * prior_sv_a_);
   }
   
   // sample aux_sigma2_omega
-  aux_sigma2_omega_n    = randg( distr_param(1 + 0.5 * prior_sv_a_, pow(pow(prior_sv_s_,-1) + pow(2 * aux_sigma2v_n,-1), -1)  ) );
+  aux_sigma2_omega_n    = rng_randg( 1 + 0.5 * prior_sv_a_, pow(pow(prior_sv_s_,-1) + pow(2 * aux_sigma2v_n,-1), -1) );
   
   // sample aux_rho
   rowvec    hm1         = aux_h_n.cols(0,T-2);
   double    aux_rho_var = as_scalar(pow( hm1 * hm1.t() / aux_sigma2v_n, -1));
   double    aux_rho_mean = as_scalar(aux_rho_var * (hm1 * aux_h_n.cols(1,T-1).t() / aux_sigma2v_n) );
-  aux_rho_n             = RcppTN::rtn1(aux_rho_mean, pow(aux_rho_var, 0.5),-1,1);
+  aux_rho_n             = rng_rtn(aux_rho_mean, pow(aux_rho_var, 0.5),-1,1);
   
-  mat       H_rho_new(T, T, fill::eye);
-  H_rho_new.diag(-1)   -= aux_rho_n;
-  H_rho                 = H_rho_new;
-  HH_rho                = H_rho_new.t() * H_rho_new;
+  // H_rho' * H_rho is tridiagonal with diagonal 1 + rho^2, the last element 1, and off-diagonal -rho
+  vec       HH_rho_diag(T);
+  HH_rho_diag.fill(1 + pow(aux_rho_n, 2));
+  HH_rho_diag(T-1)      = 1;
   
   // sample aux_sigma2v
-  aux_sigma2v_n         = (aux_sigma2_omega_n + as_scalar(aux_h_n * HH_rho * aux_h_n.t())) / chi2rnd( 3 + T );
+  aux_sigma2v_n         = (aux_sigma2_omega_n + ar1_quadratic_form(aux_h_n, aux_rho_n)) / rng_chi2rnd( 3 + T );
   aux_omega_n           = pow(aux_sigma2v_n, 0.5);
   
   // sample aux_h
-  mat       V_h         = diagmat(sigma_S_inv) + (HH_rho / aux_sigma2v_n);
-  vec       h_bar       = diagmat(sigma_S_inv) * (U - alpha_S).t();
-  aux_h_n               = trans(precision_sampler_ar1( V_h.diag(), V_h(1, 0), h_bar));
+  vec       V_h_diag    = trans(sigma_S_inv) + HH_rho_diag / aux_sigma2v_n;
+  aux_h_n               = sigma_S_inv % (U - alpha_S);
+  vec       work(T);
+  precision_sampler_ar1_inplace(aux_h_n.memptr(), work.memptr(), V_h_diag.memptr(), -aux_rho_n / aux_sigma2v_n, T);
+} // END svar_ce1
+
+
+
+// the samplers for one equation in the format of the exported functions
+static Rcpp::List svar_list1 (
+    arma::rowvec&       aux_h_n,            // 1xT
+    double&             aux_rho_n,
+    double&             aux_omega_n,
+    double&             aux_sigma2v_n,
+    double&             aux_sigma2_omega_n, // omega prior hyper-parameter 
+    double&             aux_s_n,             // scale of IG2 prior for aux_sigma2_omega_n
+    arma::urowvec&      aux_S_n,            // 1xT
+    const arma::rowvec& u,                  // 1xT
+    const Rcpp::List&   prior,
+    const bool          sample_s_,
+    const bool          centred_sv
+) {
+  bsvar_prior prior_;
+  prior_.sv_a_          = as<double>(prior["sv_a_"]);
+  prior_.sv_s_          = as<double>(prior["sv_s_"]);
+  
+  sv_state    state;
+  state.h               = trans(aux_h_n);
+  state.S               = trans(aux_S_n);
+  state.rho             = { aux_rho_n };
+  state.omega           = { aux_omega_n };
+  state.sigma2v         = { aux_sigma2v_n };
+  state.sigma2_omega    = { aux_sigma2_omega_n };
+  state.s_              = { aux_s_n };
+  
+  if ( centred_sv ) {
+    svar_ce1( state, 0, u, prior_, sample_s_ );
+  } else {
+    svar_nc1( state, 0, u, prior_, sample_s_ );
+  }
+  
+  aux_h_n               = trans(state.h.col(0));
+  aux_S_n               = trans(state.S.col(0));
+  aux_rho_n             = state.rho(0);
+  aux_omega_n           = state.omega(0);
+  aux_sigma2v_n         = state.sigma2v(0);
+  aux_sigma2_omega_n    = state.sigma2_omega(0);
+  aux_s_n               = state.s_(0);
   
   return List::create(
     _["aux_h_n"]              = aux_h_n,
@@ -356,4 +598,42 @@ Rcpp::List svar_ce1 (
     _["aux_s_n"]              = aux_s_n,
     _["aux_S_n"]              = aux_S_n
   );
+} // END svar_list1
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List svar_nc1 (
+  arma::rowvec&   aux_h_n,            // 1xT
+  double&         aux_rho_n,
+  double&         aux_omega_n,
+  double&         aux_sigma2v_n,
+  double&         aux_sigma2_omega_n, // omega prior hyper-parameter 
+  double&         aux_s_n,             // scale of IG2 prior for aux_sigma2_omega_n
+  arma::urowvec&  aux_S_n,            // 1xT
+  const arma::rowvec&   u,                  // 1xT
+  const Rcpp::List&     prior,
+  bool            sample_s_ = true
+) {
+  return svar_list1( aux_h_n, aux_rho_n, aux_omega_n, aux_sigma2v_n, aux_sigma2_omega_n, aux_s_n, aux_S_n, u, prior, sample_s_, false );
+} // END sv_nc1
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List svar_ce1 (
+    arma::rowvec&       aux_h_n,            // 1xT
+    double&             aux_rho_n,
+    double&             aux_omega_n,
+    double&             aux_sigma2v_n,
+    double&             aux_sigma2_omega_n, // omega prior hyper-parameter 
+    double&             aux_s_n,             // scale of IG2 prior for aux_sigma2_omega_n
+    arma::urowvec&      aux_S_n,            // 1xT
+    const arma::rowvec& u,                  // 1xT
+    const Rcpp::List&   prior,
+    bool                sample_s_ = true
+) {
+  return svar_list1( aux_h_n, aux_rho_n, aux_omega_n, aux_sigma2v_n, aux_sigma2_omega_n, aux_s_n, aux_S_n, u, prior, sample_s_, true );
 } // END svar_ce1
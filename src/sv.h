@@ -4,6 +4,25 @@
 
 #include <RcppArmadillo.h>
 
+#include "prior.h"
+
+
+// The SV processes of all N equations. The T-vectors of equation n are
+// the contiguous columns n of h and S so that they can be updated in place
+struct sv_state {
+  arma::mat   h;              // TxN log-volatilities
+  arma::umat  S;              // TxN auxiliary mixture indicators
+  arma::vec   rho;            // Nx1
+  arma::vec   omega;          // Nx1
+  arma::vec   sigma2v;        // Nx1
+  arma::vec   sigma2_omega;   // Nx1 omega prior hyper-parameter
+  arma::vec   s_;             // Nx1 scale of IG2 prior for sigma2_omega
+};
+
+sv_state read_sv_state (
+    const Rcpp::List& starting_values     // a list of starting values with NxT h and S
+);
+
 double do_rgig1(
     double lambda, 
     double chi, 
@@ -30,6 +49,15 @@ arma::vec backward_algorithm(
 );
 
 
+void precision_sampler_ar1_inplace (
+    double*             draw,               // T, the location on input
+    double*             work,               // T
+    const double*       precision_diag,     // T
+    const double        precision_offdiag,
+    const int           T
+);
+
+
 arma::vec precision_sampler_ar1(
     const arma::vec&    precision_diag,
     const double&       precision_offdiag,
@@ -37,6 +65,13 @@ arma::vec precision_sampler_ar1(
 );
 
 
+arma::mat precision_sampler_ar1_batch (
+    const arma::mat&    precision_diag,       // NxT
+    const arma::vec&    precision_offdiag,    // N
+    const arma::mat&    location              // NxT
+);
+
+
 arma::uvec inverse_transform_sampling (
     const arma::vec&  mixprob,
     const int         T
@@ -48,6 +83,15 @@ arma::vec find_mixture_indicator_cdf (
 );
 
 
+double sample_sv_update1 (
+    const double    h_T,
+    const double    u,                  // the structural shock at T+1
+    const double    rho,
+    const double    omega,
+    const bool      centred_sv
+);
+
+
 Rcpp::List svar_nc1 (
     arma::rowvec&   aux_h_n,              // 1xT
     double&         aux_rho_n,
@@ -61,6 +105,7 @@ Rcpp::List svar_nc1 (
     bool            sample_s_ = true
 );
 
+
 Rcpp::List svar_ce1 (
     arma::rowvec&       aux_h_n,            // 1xT
     double&             aux_rho_n,
@@ -74,4 +119,21 @@ Rcpp::List svar_ce1 (
     bool                sample_s_ = true
 );
 
+
+void svar_nc1 (
+    sv_state&             state,          // SV states of all equations, equation n is updated in place
+    const int             n,              // equation index
+    const arma::rowvec&   u,              // 1xT
+    const bsvar_prior&    prior,
+    const bool            sample_s_ = true
+);
+
+void svar_ce1 (
+    sv_state&             state,          // SV states of all equations, equation n is updated in place
+    const int             n,              // equation index
+    const arma::rowvec&   u,              // 1xT
+    const bsvar_prior&    prior,
+    const bool            sample_s_ = true
+);
+
 #endif  // _SV_H_
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include <RcppArmadillo.h>
+
+#include "timer.h"
+
+using namespace Rcpp;
+
+
+block_timer::block_timer (
+    const std::vector<std::string>& blocks_,
+    const int                       level_,
+    const int                       N
+) : level(level_), blocks(blocks_), seconds(blocks_.size(), 0.0), calls(blocks_.size(), 0) {
+  if ( level > 1 ) {
+    equation_seconds.assign(N, 0.0);
+  }
+  started           = clock::now();
+  last              = started;
+} // END block_timer
+
+
+
+SEXP block_timer::result () const {
+  if ( level == 0 ) return R_NilValue;
+  
+  const double  total   = std::chrono::duration<double>(clock::now() - started).count();
+  List  out             = List::create(
+    _["block"]          = wrap(blocks),
+    _["seconds"]        = wrap(seconds),
+    _["calls"]          = wrap(calls),
+    _["total_seconds"]  = total
+  );
+  if ( level > 1 && equation_seconds.size() > 0 ) {
+    out["equation_seconds"] = wrap(equation_seconds);
+  }
+  return out;
+} // END result
@@ -0,0 +1,57 @@
+#ifndef _TIMER_H_
+#define _TIMER_H_
+
+#include <RcppArmadillo.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+// Wall time and call counts of the sampling blocks of a Gibbs sampler. At level 0 every
+// call returns immediately, at level 1 toc(k) adds the time since the previous tic or
+// toc to block k, and at level 2 the times of the equations are also accumulated.
+// tic and toc share the time point last and are called on the main thread only; worker
+// threads may call add_equation for distinct equations.
+class block_timer {
+  public:
+    typedef std::chrono::steady_clock clock;
+    
+    block_timer (const std::vector<std::string>& blocks, const int level, const int N = 0);
+    
+    bool  enabled () const    { return level > 0; }
+    bool  equations () const  { return level > 1; }
+    
+    void  tic () {
+      if (level > 0) last = clock::now();
+    }
+    
+    void  toc (const int block) {
+      if (level > 0) {
+        const clock::time_point now = clock::now();
+        seconds[block]         += std::chrono::duration<double>(now - last).count();
+        calls[block]++;
+        last                    = now;
+      }
+    }
+    
+    void  add_equation (const int n, const double elapsed) {
+      if (level > 1) equation_seconds[n] += elapsed;
+    }
+    
+    static double now () {
+      return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+    }
+    
+    SEXP  result () const;          // R_NilValue at level 0
+    
+  private:
+    int                       level;
+    std::vector<std::string>  blocks;
+    std::vector<double>       seconds;
+    std::vector<int>          calls;
+    std::vector<double>       equation_seconds;
+    clock::time_point         started, last;
+};
+
+
+#endif  // _TIMER_H_
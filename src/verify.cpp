@@ -2,6 +2,7 @@
 #include "Rcpp/Rmath.h"
 
 #include "utils.h"
+#include "parallel.h"
 
 using namespace Rcpp;
 using namespace arma;
@@ -14,7 +15,8 @@ Rcpp::List verify_volatility_sv_cpp (
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
     const arma::mat&        X,          // KxT explanatory variables
-    const bool              sample_s_ = true
+    const bool              sample_s_ = true,
+    const int               threads = 1
 ) {
   // computes the log of SDDR for homoskedasticity hypothesis omega_n = 0
   // see Lütkepohl, Shang, Uzeda, Woźniak (2013)
@@ -35,8 +37,8 @@ Rcpp::List verify_volatility_sv_cpp (
   const int     N               = Y.n_rows;
   
   // fixed values for auxiliary mixture
-  const NumericVector alpha_s = NumericVector::create(1.92677,1.34744,0.73504,0.02266,0-0.85173,-1.97278,-3.46788,-5.55246,-8.68384,-14.65000);
-  const NumericVector sigma_s = NumericVector::create(0.11265,0.17788,0.26768,0.40611,0.62699,0.98583,1.57469,2.54498,4.16591,7.33342);
+  const vec     alpha_s         = {1.92677,1.34744,0.73504,0.02266,-0.85173,-1.97278,-3.46788,-5.55246,-8.68384,-14.65000};
+  const vec     sigma_s_inv     = 1 / vec({0.11265,0.17788,0.26768,0.40611,0.62699,0.98583,1.57469,2.54498,4.16591,7.33342});
   
   if ( prior_a_ <= 0.5 ) {
     stop("'prior$sv_a_' must be greater than 0.5");
@@ -53,25 +55,34 @@ Rcpp::List verify_volatility_sv_cpp (
   }
   double  log_denominator     = - 0.5 * log(2 * M_PI) + log(inv_sqrt_s_) - log(pow(prior_a_, 2) - 0.25) + R::lgammafn(prior_a_ + 1.5) - R::lgammafn(prior_a_);
   
-  // compute numerator
+  // compute numerator; the draws are independent given the posterior sample
   mat     log_numerator_s(N, S);
+  parallel_error  error;
+  
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
   for (int s = 0; s < S; s++) {
-    for (int n = 0; n < N; n++) {
-      mat     residuals       = log(square(posterior_B.slice(s) * (Y - posterior_A.slice(s) * X)));
-      
-      rowvec  alpha_S(T);
-      vec     sigma_S_inv(T);
-      for (int t = 0; t < T; t++) {
-        rowvec  post_S        = posterior_S.slice(s).row(n);
-        alpha_S.col(t)        = alpha_s(post_S(t));
-        sigma_S_inv.row(t)    = 1/sigma_s(post_S(t));
-      } // END t loop
+    try {
+      const mat   residuals     = log(square(posterior_B.slice(s) * (Y - posterior_A.slice(s) * X)));
       
-      double  V_omega         = pow(as_scalar(posterior_h.slice(s).row(n) * diagmat(sigma_S_inv) * trans(posterior_h.slice(s).row(n))) + pow(posterior_sigma2_omega(n, s), -1), -1);
-      double  omega_bar       = V_omega * as_scalar(posterior_h.slice(s).row(n) * diagmat(sigma_S_inv) * trans(residuals.row(n) - alpha_S));
-      log_numerator_s(n, s)   = R::dnorm(0, omega_bar, sqrt(V_omega), true);
-    } // END n loop
+      for (int n = 0; n < N; n++) {
+        rowvec  alpha_S(T);
+        rowvec  sigma_S_inv(T);
+        for (int t = 0; t < T; t++) {
+          const uword   st      = posterior_S(n, t, s);
+          alpha_S(t)            = alpha_s(st);
+          sigma_S_inv(t)        = sigma_s_inv(st);
+        } // END t loop
+        
+        const rowvec  h_sigma   = posterior_h.slice(s).row(n) % sigma_S_inv;
+        double  V_omega         = 1 / (dot(h_sigma, posterior_h.slice(s).row(n)) + pow(posterior_sigma2_omega(n, s), -1));
+        double  omega_bar       = V_omega * dot(h_sigma, residuals.row(n) - alpha_S);
+        log_numerator_s(n, s)   = - 0.5 * log(2 * M_PI * V_omega) - 0.5 * pow(omega_bar, 2) / V_omega;
+      } // END n loop
+    } catch (std::exception& e) {
+      error.record(e);
+    }
   } // END s loop
+  error.rethrow();
   
   // compute the log of the mean numerator exp(log_numerator)
   vec log_numerator           = log_mean(log_numerator_s);
@@ -165,7 +176,8 @@ Rcpp::List verify_volatility_msh_cpp (
     const Rcpp::List&       posterior,  // a list of posteriors
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
-    const arma::mat&        X          // KxT explanatory variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const int               threads = 1
 ) {
   
   cube  posterior_sigma2    = posterior["sigma2"];
@@ -182,32 +194,40 @@ Rcpp::List verify_volatility_msh_cpp (
   
   // compute denominator
   
-  rowvec  prior_nu(M, fill::value(as<double>(prior["sigma_nu"])));
-  rowvec  prior_s(M, fill::value(as<double>(prior["sigma_s"])));
+  const double  prior_sigma_nu  = as<double>(prior["sigma_nu"]);
+  const double  prior_sigma_s   = as<double>(prior["sigma_s"]);
+  rowvec  prior_nu(M, fill::value(prior_sigma_nu));
+  rowvec  prior_s(M, fill::value(prior_sigma_s));
   
   double  log_denominator = dig2dirichlet( homoskedasticity_hypothesis, prior_nu, prior_s );
   
-  // compute numerator
+  // compute numerator; the posterior parameters are common to all equations of draw s
   mat     log_numerator_s(N, S);
+  parallel_error  error;
+  
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
   for (int s = 0; s < S; s++) {
-    for (int n = 0; n < N; n++) {
-      
-      rowvec posterior_nu   = sum(posterior_xi.slice(s), 1).t() + as<double>(prior["sigma_nu"]);
+    try {
+      const rowvec  posterior_nu  = sum(posterior_xi.slice(s), 1).t() + prior_sigma_nu;
+      const mat     residuals2    = square(posterior_B.slice(s) * (Y - posterior_A.slice(s) * X));   // NxT
       
-      mat posterior_s(N, M);
-      posterior_s.fill(prior["sigma_s"]);
+      mat posterior_s(N, M, fill::value(prior_sigma_s));
       for (int m=0; m<M; m++) {
         for (int t=0; t<T; t++) {
           if (posterior_xi(m,t,s)==1) {
-            posterior_s.col(m) += square(posterior_B.slice(s) * (Y.col(t) - posterior_A.slice(s) * X.col(t)));
+            posterior_s.col(m) += residuals2.col(t);
           }
         }
       }
       
-      log_numerator_s(n,s)  = M * log(M) * dig2dirichlet( homoskedasticity_hypothesis, posterior_nu, posterior_s.row(n) );
-      
-    } // END n loop
+      for (int n = 0; n < N; n++) {
+        log_numerator_s(n,s)  = M * log(M) * dig2dirichlet( homoskedasticity_hypothesis, posterior_nu, posterior_s.row(n) );
+      } // END n loop
+    } catch (std::exception& e) {
+      error.record(e);
+    }
   } // END s loop
+  error.rethrow();
   
   // compute the log of the mean numerator exp(log_numerator)
   vec log_numerator           = log_mean(log_numerator_s);
@@ -308,141 +328,239 @@ double dmvnorm_mean_var (
 
 
 
-// [[Rcpp::interfaces(cpp)]]
-// [[Rcpp::export]]
-Rcpp::List verify_autoregressive_heterosk_cpp (
-    const arma::mat&        hypothesis, // an NxK matrix of values under the null; value 999 stands for not verivied
+/*______________________function dmvnorm_chol_var______________________*/
+// the log-density of N(mean, var) at x using the lower-triangular Cholesky factor of var 
+static double dmvnorm_chol_var (
+    const arma::vec&      x,
+    const arma::vec&      mean,
+    const arma::mat&      chol_var        // lower-triangular, var = chol_var * chol_var'
+) {
+  const int     N       = x.n_elem;
+  const double  log2pi  = std::log(2.0 * M_PI);
+  const vec     z       = solve(trimatl(chol_var), x - mean);
+  return -0.5 * N * log2pi - accu(log(chol_var.diag())) - 0.5 * dot(z, z);
+} // END dmvnorm_chol_var
+
+
+
+/*______________________function verify_autoregressive______________________*/
+// the SDDRs for several hypotheses about A computed in one pass over the posterior draws;
+// the full conditional precision of row n of A is formed as in the Kronecker-free samplers 
+// of A and its Cholesky factor R, R'R = precision, is computed once per (n, s) for all the 
+// hypotheses; the marginal covariance of the verified elements indi is G'G, G = R'^{-1} I(:, indi)
+static Rcpp::List verify_autoregressive (
+    const arma::field<arma::mat>& hypotheses, // NxK matrices of values under the null; value 999 stands for not verified
     const Rcpp::List&       posterior,  // a list of posteriors
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
-    const arma::mat&        X           // KxT explanatory variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const bool              heterosk,
+    const int               threads
 ) {
   
-  cube    posterior_A         = posterior["A"];
-  cube    posterior_B         = posterior["B"];
-  cube    posterior_hyper     = posterior["hyper"];
-  cube    posterior_sigma     = posterior["sigma"];
+  const cube    posterior_A         = posterior["A"];
+  const cube    posterior_B         = posterior["B"];
+  const cube    posterior_hyper     = posterior["hyper"];
+  cube          posterior_sigma;
+  if ( heterosk ) {
+    posterior_sigma                 = as<cube>(posterior["sigma"]);
+  }
   
-  double  prior_hyper_nu_A    = as<double>(prior["hyper_nu_A"]);
-  double  prior_hyper_a_A     = as<double>(prior["hyper_a_A"]);
-  double  prior_hyper_s_AA    = as<double>(prior["hyper_s_AA"]);
-  double  prior_hyper_nu_AA   = as<double>(prior["hyper_nu_AA"]);
+  const double  prior_hyper_nu_A    = as<double>(prior["hyper_nu_A"]);
+  const double  prior_hyper_a_A     = as<double>(prior["hyper_a_A"]);
+  const double  prior_hyper_s_AA    = as<double>(prior["hyper_s_AA"]);
+  const double  prior_hyper_nu_AA   = as<double>(prior["hyper_nu_AA"]);
   
-  mat     prior_A             = as<mat>(prior["A"]);
-  mat     prior_A_V_inv       = as<mat>(prior["A_V_inv"]);
+  const mat     prior_A             = as<mat>(prior["A"]);
+  const mat     prior_A_Vinv        = as<mat>(prior["A_V_inv"]);
   
   const int N                 = posterior_A.n_rows;
   const int K                 = posterior_A.n_cols;
   const int S                 = posterior_A.n_slices;
-  const int T                 = Y.n_cols;
+  const int H                 = hypotheses.n_elem;
   const double log2pi         = std::log(2.0 * M_PI);
   
-  mat aux_sigma(N, T, fill::ones);
-  
-  mat prior_A_mean            = as<mat>(prior["A"]);
-  mat prior_A_Vinv            = as<mat>(prior["A_V_inv"]);
-  rowvec    zerosA(K);
-  
-  // intermediate output matrices
-  double    log_numerator = 0;
-  vec       log_numerator_n(N);
-  mat       log_numerator_s(N, S);
-  double    log_denominator = 0;
-  vec       log_denominator_n(N);
-  mat       log_denominator_s(N, S);
-  double    logSDDR_se = 0;
-  
-  // for NSE computations
-  int   nse_subsamples        = 30;
-  rowvec    se_components(nse_subsamples);
-  int   nn                    = floor(S/nse_subsamples);
-  uvec  seq_1S                = as<uvec>(wrap(seq_len(S) - 1));
+  // the verified elements of every row for every hypothesis
+  field<uvec> indi(N, H);
+  uvec        verified_n(N, fill::zeros);
+  for (int h=0; h<H; h++) {
+    for (int n=0; n<N; n++) {
+      indi(n, h)              = find( hypotheses(h).row(n) != 999 );
+      if ( indi(n, h).n_elem > 0 ) verified_n(n) = 1;
+    }
+  }
   
   // level 1 prior - no need for loop
   mat hyper_sample(2 * N + 1, S);
   hyper_sample.row(2 * N)     = trans(prior_hyper_s_AA / chi2rnd( prior_hyper_nu_AA, S ));
   
+  // compute denominators; the prior draws are made in the order of the n and s loops
+  cube      log_denominator_s(N, S, H, fill::zeros);
   for (int n=0; n<N; n++) {
-
-    // investigate hypothesis
-    uvec  indi                = find( hypothesis.row(n) != 999 );
-    if ( indi.n_elem == 0 ) {
-      continue;
-    }
-          
+    if ( verified_n(n) == 0 ) continue;
     for (int s=0; s<S; s++) {
-      
-      // compute denominator
       double gamma_draw       = randg( distr_param(prior_hyper_a_A, hyper_sample(2 * N, s)) );
       hyper_sample(N + n, s)  = gamma_draw;
       hyper_sample(n, s)      = gamma_draw / chi2rnd( prior_hyper_nu_A );
       
-      double const_prior      = - 0.5 * indi.n_elem * ( log2pi + log(hyper_sample(n, s)) );
-      rowvec hypothesis_n     = hypothesis.row(n) - prior_A.row(n);
-      double kernel_prior     = - 0.5 * pow(hyper_sample(n, s), -1) * accu( pow( hypothesis_n.cols(indi), 2)  );
+      for (int h=0; h<H; h++) {
+        if ( indi(n, h).n_elem == 0 ) continue;
+        double const_prior    = - 0.5 * indi(n, h).n_elem * ( log2pi + log(hyper_sample(n, s)) );
+        rowvec hypothesis_n   = hypotheses(h).row(n) - prior_A.row(n);
+        double kernel_prior   = - 0.5 * pow(hyper_sample(n, s), -1) * accu( pow( hypothesis_n.cols(indi(n, h)), 2)  );
+        log_denominator_s(n, s, h) = const_prior + kernel_prior;
+      } // END h loop
+    } // END s loop
+  } // END n loop
+  
+  // compute numerators in parallel over the posterior draws
+  const mat XX                = X * X.t();                    // KxK
+  const mat I_K               = eye(K, K);
+  cube      log_numerator_s(N, S, H, fill::zeros);
+  parallel_error  error;
+  
+  #pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int s=0; s<S; s++) {
+    try {
+      const mat&  aux_B       = posterior_B.slice(s);
+      const mat&  aux_A       = posterior_A.slice(s);
+      const mat   E           = Y - aux_A * X;                // NxT
+      mat         sigma2_inv;
+      if ( heterosk ) {
+        sigma2_inv            = pow(posterior_sigma.slice(s), -2);
+      }
       
-      log_denominator_s(n, s) = const_prior + kernel_prior;
+      for (int n=0; n<N; n++) {
+        if ( verified_n(n) == 0 ) continue;
+        
+        const vec   bn        = aux_B.col(n);
+        const mat   Zn        = aux_B * E + bn * (aux_A.row(n) * X);    // NxT = B(Y - A0X)
+        const mat   prior_precision = pow(posterior_hyper(n,1,s), -1) * prior_A_Vinv;
+        
+        mat     precision;
+        rowvec  location;
+        if ( heterosk ) {
+          const rowvec  wn    = trans(square(bn)) * sigma2_inv;         // 1xT
+          const rowvec  vn    = trans(bn) * (Zn % sigma2_inv);          // 1xT
+          precision           = prior_precision + (X.each_row() % wn) * X.t();
+          location            = prior_A.row(n) * prior_precision + vn * X.t();
+        } else {
+          precision           = prior_precision + dot(bn, bn) * XX;
+          location            = prior_A.row(n) * prior_precision + trans(X * (Zn.t() * bn));
+        }
+        precision             = 0.5 * (precision + precision.t());
+        
+        const mat   chol_precision  = chol(precision);              // upper-triangular
+        const vec   mean_tmp  = solve(trimatu(chol_precision), solve(trimatl(chol_precision.t()), location.t()));
+        
+        for (int h=0; h<H; h++) {
+          const uvec& indi_nh = indi(n, h);
+          if ( indi_nh.n_elem == 0 ) continue;
+          
+          const mat   G             = solve(trimatl(chol_precision.t()), I_K.cols(indi_nh));
+          const mat   chol_var_marg = chol(G.t() * G, "lower");
+          const vec   hypothesisn   = trans(hypotheses(h).row(n));
+          log_numerator_s(n, s, h)  = dmvnorm_chol_var( hypothesisn.rows(indi_nh), mean_tmp.rows(indi_nh), chol_var_marg );
+        } // END h loop
+      } // END n loop
+    } catch (std::exception& e) {
+      error.record(e);
+    }
+  } // END s loop
+  error.rethrow();
+  
+  // wrap up the SDDR computations for every hypothesis
+  int   nse_subsamples        = 30;
+  int   nn                    = floor(S/nse_subsamples);
+  uvec  seq_1S                = as<uvec>(wrap(seq_len(S) - 1));
+  
+  List  out(H);
+  for (int h=0; h<H; h++) {
+    double    log_numerator = 0;
+    vec       log_numerator_n(N);
+    double    log_denominator = 0;
+    vec       log_denominator_n(N);
+    double    logSDDR_se = 0;
+    rowvec    se_components(nse_subsamples);
+    const mat log_numerator_s_h   = log_numerator_s.slice(h);
+    const mat log_denominator_s_h = log_denominator_s.slice(h);
+    
+    for (int n=0; n<N; n++) {
+      if ( indi(n, h).n_elem == 0 ) continue;
       
-      // compute numerator
-      aux_sigma               = posterior_sigma.slice(s);
-      vec   sigma_vectorised  = vectorise(aux_sigma);
-      mat   A0                = posterior_A.slice(s);
-      A0.row(n)               = zerosA;
-      mat   aux_B             = posterior_B.slice(s);
-      vec   zn                = vectorise( aux_B * (Y - A0 * X) );
-      mat   zn_sigma          = zn / sigma_vectorised;
-      mat   Wn                = kron( trans(X), aux_B.col(n) );
-      mat   Wn_sigma          = Wn.each_col() / sigma_vectorised;
+      log_numerator_n(n)        = as_scalar(log_mean(log_numerator_s_h.row(n)));
+      log_denominator_n(n)      = as_scalar(log_mean(log_denominator_s_h.row(n)));
       
-      mat     precision_tmp   = (pow(posterior_hyper(n,1,s), -1) * prior_A_Vinv) + trans(Wn_sigma) * Wn_sigma;
-      precision_tmp           = 0.5 * (precision_tmp + precision_tmp.t());
-      rowvec  location_tmp    = prior_A_mean.row(n) * (pow(posterior_hyper(n,1,s), -1) * prior_A_Vinv) + trans(zn_sigma) * Wn_sigma;
-      mat     variance_tmp    = inv_sympd(precision_tmp);
-      vec     mean_tmp        = variance_tmp * location_tmp.t();
-      mat     variance_marg   = variance_tmp.submat(indi, indi);
-      vec     mean_marg       = mean_tmp.rows(indi);
-      vec     hypothesisn     = trans(hypothesis.row(n));
+      log_numerator            += log_numerator_n(n);
+      log_denominator          += log_denominator_n(n);
       
-      log_numerator_s(n,s)    = dmvnorm_mean_var( hypothesisn.rows(indi), mean_marg, variance_marg, true );
-    } // END s loop
-    
-    // wrap up the SDDR computation
-    log_numerator_n(n)        = as_scalar(log_mean(log_numerator_s.row(n)));
-    log_denominator_n(n)      = as_scalar(log_mean(log_denominator_s.row(n)));
+      // NSE computations
+      if ( S >= 60 ) {
+        for (int i=0; i<nse_subsamples; i++) {
+          // sub-sampling elements' indicators
+          uvec  indi_i            = seq_1S.subvec(i*nn, (i+1)*nn-1);
+          
+          rowvec log_numerator_s_subsample      = log_numerator_s_h.row(n);
+          rowvec log_denominator_s_subsample    = log_denominator_s_h.row(n);
+          
+          se_components(i)       += as_scalar(log_mean(log_numerator_s_subsample.cols(indi_i)) 
+                                                - log_mean(log_denominator_s_subsample.cols(indi_i)));
+        } // END i loop
+      } // END if
+    } // END n loop
     
-    log_numerator            += log_numerator_n(n);
-    log_denominator          += log_denominator_n(n);
+    if ( S >= 60 ) {
+      logSDDR_se           = stddev(se_components, 1);
+    } // END if
     
-    // NSE computations
-    if ( S >= 60) {
-      for (int i=0; i<nse_subsamples; i++) {
-        // sub-sampling elements' indicators
-        uvec  indi              = seq_1S.subvec(i*nn, (i+1)*nn-1);
-        
-        rowvec log_numerator_s_subsample      = log_numerator_s.row(n);
-        rowvec log_denominator_s_subsample    = log_denominator_s.row(n);
-        
-        se_components(i)       += as_scalar(log_mean(log_numerator_s_subsample.cols(indi)) 
-                                              - log_mean(log_denominator_s_subsample.cols(indi)));
-      } // END i loop
-    } // END if  
-  } // END n loop
+    out[h]          = List::create(
+      _["logSDDR"]     = log_numerator - log_denominator,
+      _["log_SDDR_se"] = logSDDR_se,
+      _["components"]  = List::create(
+        _["log_denominator"]    = log_denominator,
+        _["log_numerator"]      = log_numerator,
+        _["log_numerator_s"]    = log_numerator_s_h,
+        _["log_denominator_s"]  = log_denominator_s_h,
+        _["se_components"]      = se_components
+      )
+    );
+  } // END h loop
   
-  if ( S >= 60) {
-    logSDDR_se           = stddev(se_components, 1);
-  } // END if  
-  
-  return List::create(
-    _["logSDDR"]     = log_numerator - log_denominator,
-    _["log_SDDR_se"] = logSDDR_se,
-    _["components"]  = List::create(
-      _["log_denominator"]    = log_denominator,
-      _["log_numerator"]      = log_numerator,
-      _["log_numerator_s"]    = log_numerator_s,
-      _["log_denominator_s"]  = log_denominator_s,
-      _["se_components"]      = se_components
-    )
-  );
+  return out;
+} // END verify_autoregressive
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List verify_autoregressive_cpp (
+    const arma::field<arma::mat>& hypotheses, // NxK matrices of values under the null; value 999 stands for not verified
+    const Rcpp::List&       posterior,  // a list of posteriors
+    const Rcpp::List&       prior,      // a list of priors - original dimensions
+    const arma::mat&        Y,          // NxT dependent variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const bool              heterosk = true,
+    const int               threads = 1
+) {
+  return verify_autoregressive(hypotheses, posterior, prior, Y, X, heterosk, threads);
+} // END verify_autoregressive_cpp
+
+
+
+// [[Rcpp::interfaces(cpp)]]
+// [[Rcpp::export]]
+Rcpp::List verify_autoregressive_heterosk_cpp (
+    const arma::mat&        hypothesis, // an NxK matrix of values under the null; value 999 stands for not verivied
+    const Rcpp::List&       posterior,  // a list of posteriors
+    const Rcpp::List&       prior,      // a list of priors - original dimensions
+    const arma::mat&        Y,          // NxT dependent variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const int               threads = 1
+) {
+  field<mat>  hypotheses(1);
+  hypotheses(0)       = hypothesis;
+  List        out     = verify_autoregressive(hypotheses, posterior, prior, Y, X, true, threads);
+  return out[0];
 } // END verify_autoregressive_heterosk_cpp
 
 
@@ -454,122 +572,11 @@ Rcpp::List verify_autoregressive_homosk_cpp (
     const Rcpp::List&       posterior,  // a list of posteriors
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
-    const arma::mat&        X           // KxT explanatory variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const int               threads = 1
 ) {
-  
-  cube    posterior_A         = posterior["A"];
-  cube    posterior_B         = posterior["B"];
-  cube    posterior_hyper     = posterior["hyper"];
-  
-  double  prior_hyper_nu_A    = as<double>(prior["hyper_nu_A"]);
-  double  prior_hyper_a_A     = as<double>(prior["hyper_a_A"]);
-  double  prior_hyper_s_AA    = as<double>(prior["hyper_s_AA"]);
-  double  prior_hyper_nu_AA   = as<double>(prior["hyper_nu_AA"]);
-  
-  mat     prior_A             = as<mat>(prior["A"]);
-  mat     prior_A_V_inv       = as<mat>(prior["A_V_inv"]);
-  
-  const int N                 = posterior_A.n_rows;
-  const int K                 = posterior_A.n_cols;
-  const int S                 = posterior_A.n_slices;
-  const double log2pi         = std::log(2.0 * M_PI);
-  
-  mat prior_A_mean            = as<mat>(prior["A"]);
-  mat prior_A_Vinv            = as<mat>(prior["A_V_inv"]);
-  rowvec    zerosA(K);
-  
-  // intermediate output matrices
-  double    log_numerator = 0;
-  vec       log_numerator_n(N);
-  mat       log_numerator_s(N, S);
-  double    log_denominator = 0;
-  vec       log_denominator_n(N);
-  mat       log_denominator_s(N, S);
-  double    logSDDR_se = 0;
-  
-  // for NSE computations
-  int   nse_subsamples        = 30;
-  rowvec    se_components(nse_subsamples);
-  int   nn                    = floor(S/nse_subsamples);
-  uvec  seq_1S                = as<uvec>(wrap(seq_len(S) - 1));
-  
-  // level 1 prior - no need for loop
-  mat hyper_sample(2 * N + 1, S);
-  hyper_sample.row(2 * N)     = trans(prior_hyper_s_AA / chi2rnd( prior_hyper_nu_AA, S ));
-  
-  for (int n=0; n<N; n++) {
-    
-    // investigate hypothesis
-    uvec  indi                = find( hypothesis.row(n) != 999 );
-    if ( indi.n_elem == 0 ) {
-      continue;
-    }
-    
-    for (int s=0; s<S; s++) {
-      
-      // compute denominator
-      double gamma_draw       = randg( distr_param(prior_hyper_a_A, hyper_sample(2 * N, s)) );
-      hyper_sample(N + n, s)  = gamma_draw;
-      hyper_sample(n, s)      = gamma_draw / chi2rnd( prior_hyper_nu_A );
-      
-      double const_prior      = - 0.5 * indi.n_elem * ( log2pi + log(hyper_sample(n, s)) );
-      rowvec hypothesis_n     = hypothesis.row(n) - prior_A.row(n);
-      double kernel_prior     = - 0.5 * pow(hyper_sample(n, s), -1) * accu( pow( hypothesis_n.cols(indi), 2)  );
-      
-      log_denominator_s(n, s) = const_prior + kernel_prior;
-      
-      // compute numerator
-      mat   A0          = posterior_A.slice(s);
-      A0.row(n)         = zerosA;
-      vec   zn          = vectorise( posterior_B.slice(s) * (Y - A0 * X) );
-      mat   Wn          = kron( trans(X), posterior_B.slice(s).col(n) );
-      
-      mat     precision_tmp   = (pow(posterior_hyper(n,1,s), -1) * prior_A_Vinv) + trans(Wn) * Wn;
-      rowvec  location_tmp    = prior_A_mean.row(n) * (pow(posterior_hyper(n,1,s), -1) * prior_A_Vinv) + trans(zn) * Wn;
-      mat     variance_tmp    = inv_sympd(precision_tmp);
-      vec     mean_tmp        = variance_tmp * location_tmp.t();
-      mat     variance_marg   = variance_tmp.submat(indi, indi);
-      vec     mean_marg       = mean_tmp.rows(indi);
-      vec     hypothesisn     = trans(hypothesis.row(n));
-        
-      log_numerator_s(n,s)    = dmvnorm_mean_var( hypothesisn.rows(indi), mean_marg, variance_marg, true );
-    } // END s loop
-    
-    // wrap up the SDDR computation
-    log_numerator_n(n)        = as_scalar(log_mean(log_numerator_s.row(n)));
-    log_denominator_n(n)      = as_scalar(log_mean(log_denominator_s.row(n)));
-    
-    log_numerator            += log_numerator_n(n);
-    log_denominator          += log_denominator_n(n);
-    
-    // NSE computations
-    if ( S >= 60 ) {
-      for (int i=0; i<nse_subsamples; i++) {
-        // sub-sampling elements' indicators
-        uvec  indi              = seq_1S.subvec(i*nn, (i+1)*nn-1);
-        
-        rowvec log_numerator_s_subsample      = log_numerator_s.row(n);
-        rowvec log_denominator_s_subsample    = log_denominator_s.row(n);
-        
-        se_components(i)       += as_scalar(log_mean(log_numerator_s_subsample.cols(indi)) 
-                                              - log_mean(log_denominator_s_subsample.cols(indi)));
-      } // END i loop
-    } // END if
-  } // END n loop
-  
-  if ( S >= 60 ) {
-    logSDDR_se           = stddev(se_components, 1);
-  } // END if
-  
-  return List::create(
-    _["logSDDR"]     = log_numerator - log_denominator,
-    _["log_SDDR_se"] = logSDDR_se,
-    _["components"]  = List::create(
-      _["log_denominator"]    = log_denominator,
-      _["log_numerator"]      = log_numerator,
-      _["log_numerator_s"]    = log_numerator_s,
-      _["log_denominator_s"]  = log_denominator_s,
-      _["se_components"]      = se_components
-    )
-  );
+  field<mat>  hypotheses(1);
+  hypotheses(0)       = hypothesis;
+  List        out     = verify_autoregressive(hypotheses, posterior, prior, Y, X, false, threads);
+  return out[0];
 } // END verify_autoregressive_homosk_cpp
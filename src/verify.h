@@ -10,7 +10,8 @@ Rcpp::List verify_volatility_sv_cpp (
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
     const arma::mat&        X,          // KxT explanatory variables
-    const bool              sample_s_ = true
+    const bool              sample_s_ = true,
+    const int               threads = 1
 );
 
 
@@ -33,7 +34,8 @@ Rcpp::List verify_volatility_msh_cpp (
     const Rcpp::List&       posterior,  // a list of posteriors
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
-    const arma::mat&        X           // KxT explanatory variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const int               threads = 1
 );
 
 
@@ -58,7 +60,8 @@ Rcpp::List verify_autoregressive_heterosk_cpp (
     const Rcpp::List&       posterior,  // a list of posteriors
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
-    const arma::mat&        X           // KxT explanatory variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const int               threads = 1
 );
 
 
@@ -67,7 +70,19 @@ Rcpp::List verify_autoregressive_homosk_cpp (
     const Rcpp::List&       posterior,  // a list of posteriors
     const Rcpp::List&       prior,      // a list of priors - original dimensions
     const arma::mat&        Y,          // NxT dependent variables
-    const arma::mat&        X           // KxT explanatory variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const int               threads = 1
+);
+
+
+Rcpp::List verify_autoregressive_cpp (
+    const arma::field<arma::mat>& hypotheses, // NxK matrices of values under the null; value 999 stands for not verified
+    const Rcpp::List&       posterior,  // a list of posteriors
+    const Rcpp::List&       prior,      // a list of priors - original dimensions
+    const arma::mat&        Y,          // NxT dependent variables
+    const arma::mat&        X,          // KxT explanatory variables
+    const bool              heterosk = true,
+    const int               threads = 1
 );
 
 #endif  // _VERIFY_H_
\ No newline at end of file